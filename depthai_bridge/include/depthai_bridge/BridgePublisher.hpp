@@ -1,11 +1,17 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <mutex>
 #include <thread>
 #include <type_traits>
 #include <typeinfo>
 
 #include "camera_info_manager/camera_info_manager.hpp"
 #include "depthai/device/DataQueue.hpp"
+#include "depthai_bridge/SubscriptionTracker.hpp"
+#include "depthai_bridge/WorkerPool.hpp"
 #include "image_transport/image_transport.hpp"
 #include "rclcpp/node.hpp"
 #include "rclcpp/qos.hpp"
@@ -22,6 +28,17 @@ namespace ImageMsgs = sensor_msgs::msg;
 using ImagePtr = ImageMsgs::Image::SharedPtr;
 namespace rosOrigin = ::rclcpp;
 
+/**
+ * Publishing statistics of a BridgePublisher. Age is the time between the device timestamp of a message and its publishing.
+ */
+struct BridgePublisherStats {
+    uint64_t publishedCount = 0;
+    uint64_t droppedCount = 0;
+    std::chrono::nanoseconds lastAge{0};
+    std::chrono::nanoseconds meanAge{0};
+    std::chrono::nanoseconds maxAge{0};
+};
+
 template <class RosMsg, class SimMsg>
 class BridgePublisher {
    public:
@@ -69,8 +86,26 @@ class BridgePublisher {
 
     void addPublisherCallback();
 
+    /**
+     * Runs the conversions on a shared worker pool instead of the depthai callback thread. Messages of this publisher are still
+     * converted one at a time and in order, the priority decides which publisher is served first when all workers are busy.
+     */
+    void addPublisherCallback(std::shared_ptr<WorkerPool> workerPool, WorkerPool::Priority priority = WorkerPool::Priority::NORMAL);
+
     void publishHelper(std::shared_ptr<SimMsg> inData);
 
+    /**
+     * Latest-only mode, has to be set before publishing is started. Only the newest message is converted, messages that arrive
+     * while a conversion is running replace each other and are counted as dropped. Trades completeness for latency.
+     */
+    void setLatestOnly(bool latestOnly);
+
+    /**
+     * Counters since construction or the last resetStats(), safe to call while publishing.
+     */
+    BridgePublisherStats getStats() const;
+    void resetStats();
+
     void startPublisherThread();
 
     ~BridgePublisher();
@@ -82,6 +117,21 @@ class BridgePublisher {
      */
     void daiCallback(std::string name, std::shared_ptr<ADatatype> data);
 
+    /**
+     * Single slot handed from the depthai callback to the mailbox thread in latest-only mode.
+     */
+    void postToMailbox(std::shared_ptr<SimMsg> daiDataPtr);
+    void startMailboxThread();
+    void recordPublish(const std::shared_ptr<SimMsg>& daiDataPtr);
+
+    /**
+     * Registers the publishers with the subscription tracker, publishHelper only reads the cached flags afterwards.
+     */
+    void trackSubscriptions();
+    SubscriptionTracker::Flag trackPublisher(const std::shared_ptr<image_transport::Publisher>& pub);
+    template <typename MessageT>
+    SubscriptionTracker::Flag trackPublisher(const std::shared_ptr<rclcpp::Publisher<MessageT>>& pub);
+
     static const std::string LOG_TAG;
     std::shared_ptr<dai::DataOutputQueue> _daiMessageQueue;
     ConvertFunc _converter;
@@ -94,11 +144,25 @@ class BridgePublisher {
     CustomPublisher _rosPublisher;
 
     std::thread _readingThread;
+    std::atomic<bool> _isRunning{true};
     std::string _rosTopic, _camInfoFrameId, _cameraName, _cameraParamUri;
     std::unique_ptr<camera_info_manager::CameraInfoManager> _camInfoManager;
     bool _isCallbackAdded = false;
+    int _callbackId = -1;
+    std::shared_ptr<WorkerPool> _workerPool;
+    std::shared_ptr<WorkerPool::Strand> _strand;
     bool _isImageMessage = false;  // used to enable camera info manager
     bool _lazyPublisher = true;
+    std::shared_ptr<SubscriptionTracker> _subscriptionTracker;
+    SubscriptionTracker::Flag _mainSubscribed, _infoSubscribed;
+
+    bool _latestOnly = false;
+    std::mutex _mailboxMutex;
+    std::condition_variable _mailboxCv;
+    std::shared_ptr<SimMsg> _mailbox;
+
+    std::atomic<uint64_t> _publishedCount{0}, _droppedCount{0};
+    std::atomic<int64_t> _lastAgeNs{0}, _totalAgeNs{0}, _maxAgeNs{0};
 };
 
 template <class RosMsg, class SimMsg>
@@ -113,6 +177,7 @@ BridgePublisher<RosMsg, SimMsg>::BridgePublisher(std::shared_ptr<dai::DataOutput
                                                  bool lazyPublisher)
     : _daiMessageQueue(daiMessageQueue), _node(node), _converter(converter), _it(node), _rosTopic(rosTopic), _lazyPublisher(lazyPublisher) {
     _rosPublisher = _node->create_publisher<RosMsg>(_rosTopic, qosSetting);
+    trackSubscriptions();
 }
 
 template <class RosMsg, class SimMsg>
@@ -133,6 +198,7 @@ BridgePublisher<RosMsg, SimMsg>::BridgePublisher(std::shared_ptr<dai::DataOutput
       _cameraName(cameraName),
       _lazyPublisher(lazyPublisher) {
     _rosPublisher = advertise(qosHistoryDepth, std::is_same<RosMsg, ImageMsgs::Image>{});
+    trackSubscriptions();
 }
 
 template <class RosMsg, class SimMsg>
@@ -153,6 +219,7 @@ BridgePublisher<RosMsg, SimMsg>::BridgePublisher(std::shared_ptr<dai::DataOutput
       _cameraName(cameraName),
       _lazyPublisher(lazyPublisher) {
     _rosPublisher = advertise(qosHistoryDepth, std::is_same<RosMsg, ImageMsgs::Image>{});
+    trackSubscriptions();
 }
 
 template <class RosMsg, class SimMsg>
@@ -177,11 +244,102 @@ std::shared_ptr<image_transport::Publisher> BridgePublisher<RosMsg, SimMsg>::adv
     return std::make_shared<image_transport::Publisher>(_it.advertise(_rosTopic, queueSize));
 }
 
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::trackSubscriptions() {
+    _subscriptionTracker = SubscriptionTracker::getInstance(_node->get_node_graph_interface());
+    _mainSubscribed = trackPublisher(_rosPublisher);
+    if(_isImageMessage) {
+        _infoSubscribed = trackPublisher(_cameraInfoPublisher);
+    }
+}
+
+template <class RosMsg, class SimMsg>
+SubscriptionTracker::Flag BridgePublisher<RosMsg, SimMsg>::trackPublisher(const std::shared_ptr<image_transport::Publisher>& pub) {
+    return _subscriptionTracker->track(*pub);
+}
+
+template <class RosMsg, class SimMsg>
+template <typename MessageT>
+SubscriptionTracker::Flag BridgePublisher<RosMsg, SimMsg>::trackPublisher(const std::shared_ptr<rclcpp::Publisher<MessageT>>& pub) {
+    return _subscriptionTracker->track(pub);
+}
+
 template <class RosMsg, class SimMsg>
 void BridgePublisher<RosMsg, SimMsg>::daiCallback(std::string name, std::shared_ptr<ADatatype> data) {
     // std::cout << "In callback " << name << std::endl;
     auto daiDataPtr = std::dynamic_pointer_cast<SimMsg>(data);
-    publishHelper(daiDataPtr);
+    if(_latestOnly) {
+        postToMailbox(daiDataPtr);
+    } else {
+        publishHelper(daiDataPtr);
+    }
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::postToMailbox(std::shared_ptr<SimMsg> daiDataPtr) {
+    {
+        std::lock_guard<std::mutex> lock(_mailboxMutex);
+        if(_mailbox) {
+            _droppedCount++;
+        }
+        _mailbox = std::move(daiDataPtr);
+    }
+    _mailboxCv.notify_one();
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::startMailboxThread() {
+    _readingThread = std::thread([this]() {
+        const auto mailboxTimeout = std::chrono::milliseconds(100);
+        while(rosOrigin::ok() && _isRunning) {
+            std::shared_ptr<SimMsg> daiDataPtr;
+            {
+                std::unique_lock<std::mutex> lock(_mailboxMutex);
+                _mailboxCv.wait_for(lock, mailboxTimeout, [this]() { return _mailbox != nullptr || !_isRunning; });
+                daiDataPtr = std::move(_mailbox);
+                _mailbox = nullptr;
+            }
+            if(daiDataPtr != nullptr) {
+                publishHelper(daiDataPtr);
+            }
+        }
+    });
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::setLatestOnly(bool latestOnly) {
+    _latestOnly = latestOnly;
+}
+
+template <class RosMsg, class SimMsg>
+BridgePublisherStats BridgePublisher<RosMsg, SimMsg>::getStats() const {
+    BridgePublisherStats stats;
+    stats.publishedCount = _publishedCount;
+    stats.droppedCount = _droppedCount + (_strand ? _strand->getDroppedCount() : 0);
+    stats.lastAge = std::chrono::nanoseconds(_lastAgeNs);
+    stats.meanAge = std::chrono::nanoseconds(stats.publishedCount > 0 ? _totalAgeNs / static_cast<int64_t>(stats.publishedCount) : 0);
+    stats.maxAge = std::chrono::nanoseconds(_maxAgeNs);
+    return stats;
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::resetStats() {
+    _publishedCount = 0;
+    _droppedCount = 0;
+    _lastAgeNs = 0;
+    _totalAgeNs = 0;
+    _maxAgeNs = 0;
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::recordPublish(const std::shared_ptr<SimMsg>& daiDataPtr) {
+    int64_t ageNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - daiDataPtr->getTimestamp()).count();
+    _lastAgeNs.store(ageNs, std::memory_order_relaxed);
+    _totalAgeNs.fetch_add(ageNs, std::memory_order_relaxed);
+    int64_t maxAgeNs = _maxAgeNs.load(std::memory_order_relaxed);
+    while(ageNs > maxAgeNs && !_maxAgeNs.compare_exchange_weak(maxAgeNs, ageNs, std::memory_order_relaxed)) {
+    }
+    _publishedCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 template <class RosMsg, class SimMsg>
@@ -194,20 +352,28 @@ void BridgePublisher<RosMsg, SimMsg>::startPublisherThread() {
     }
 
     _readingThread = std::thread([&]() {
-        int messageCounter = 0;
-        while(rosOrigin::ok()) {
-            // auto daiDataPtr = _daiMessageQueue->get<SimMsg>();
-            auto daiDataPtr = _daiMessageQueue->tryGet<SimMsg>();
-            if(daiDataPtr == nullptr) {
-                messageCounter++;
-                if(messageCounter > 2000000) {
-                    messageCounter = 0;
-                }
+        // Block on the queue instead of polling it. The timeout only bounds how long shutdown takes,
+        // new messages wake the thread up immediately.
+        const auto queueTimeout = std::chrono::milliseconds(100);
+        while(rosOrigin::ok() && _isRunning) {
+            bool timedOut = false;
+            std::shared_ptr<SimMsg> daiDataPtr;
+            try {
+                daiDataPtr = _daiMessageQueue->get<SimMsg>(queueTimeout, timedOut);
+            } catch(const std::runtime_error& e) {
+                // Queue was closed, device is gone.
+                break;
+            }
+            if(timedOut || daiDataPtr == nullptr) {
                 continue;
             }
-
-            if(messageCounter != 0) {
-                messageCounter = 0;
+            if(_latestOnly) {
+                // Skip straight to the newest message, everything older is stale by now.
+                auto newer = _daiMessageQueue->tryGetAll<SimMsg>();
+                if(!newer.empty()) {
+                    _droppedCount += newer.size();
+                    daiDataPtr = newer.back();
+                }
             }
             publishHelper(daiDataPtr);
         }
@@ -216,7 +382,24 @@ void BridgePublisher<RosMsg, SimMsg>::startPublisherThread() {
 
 template <class RosMsg, class SimMsg>
 void BridgePublisher<RosMsg, SimMsg>::addPublisherCallback() {
-    _daiMessageQueue->addCallback(std::bind(&BridgePublisher<RosMsg, SimMsg>::daiCallback, this, std::placeholders::_1, std::placeholders::_2));
+    if(_latestOnly) {
+        // Conversion moves off the depthai callback thread, so the device queue never backs up behind a slow conversion.
+        startMailboxThread();
+    }
+    _callbackId =
+        _daiMessageQueue->addCallback(std::bind(&BridgePublisher<RosMsg, SimMsg>::daiCallback, this, std::placeholders::_1, std::placeholders::_2));
+    _isCallbackAdded = true;
+}
+
+template <class RosMsg, class SimMsg>
+void BridgePublisher<RosMsg, SimMsg>::addPublisherCallback(std::shared_ptr<WorkerPool> workerPool, WorkerPool::Priority priority) {
+    _workerPool = workerPool;
+    // A single pending slot makes the strand replace stale messages instead of queueing them.
+    _strand = _workerPool->createStrand(priority, _latestOnly ? 1 : 8);
+    _callbackId = _daiMessageQueue->addCallback([this](std::string /*name*/, std::shared_ptr<ADatatype> data) {
+        auto daiDataPtr = std::dynamic_pointer_cast<SimMsg>(data);
+        _strand->post([this, daiDataPtr]() { publishHelper(daiDataPtr); });
+    });
     _isCallbackAdded = true;
 }
 
@@ -224,23 +407,19 @@ template <class RosMsg, class SimMsg>
 void BridgePublisher<RosMsg, SimMsg>::publishHelper(std::shared_ptr<SimMsg> inDataPtr) {
     std::deque<RosMsg> opMsgs;
 
-    int infoSubCount = 0, mainSubCount = 0;
-
-    if(_isImageMessage) {
-        infoSubCount = _node->count_subscribers(_cameraName + "/camera_info");
-    }
-    mainSubCount = _node->count_subscribers(_rosTopic);
+    bool infoSubscribed = _isImageMessage && _infoSubscribed->load(std::memory_order_relaxed);
+    bool mainSubscribed = _mainSubscribed->load(std::memory_order_relaxed);
 
-    if(!_lazyPublisher || (mainSubCount > 0 || infoSubCount > 0)) {
+    if(!_lazyPublisher || mainSubscribed || infoSubscribed) {
         _converter(inDataPtr, opMsgs);
 
         while(opMsgs.size()) {
             RosMsg currMsg = opMsgs.front();
-            if(mainSubCount > 0) {
+            if(mainSubscribed) {
                 _rosPublisher->publish(currMsg);
             }
 
-            if(infoSubCount > 0) {
+            if(infoSubscribed) {
                 auto localCameraInfo = _camInfoManager->getCameraInfo();
                 localCameraInfo.header.stamp = currMsg.header.stamp;
                 localCameraInfo.header.frame_id = currMsg.header.frame_id;
@@ -248,12 +427,21 @@ void BridgePublisher<RosMsg, SimMsg>::publishHelper(std::shared_ptr<SimMsg> inDa
             }
             opMsgs.pop_front();
         }
+        recordPublish(inDataPtr);
     }
 }
 
 template <class RosMsg, class SimMsg>
 BridgePublisher<RosMsg, SimMsg>::~BridgePublisher() {
+    _isRunning = false;
+    _mailboxCv.notify_all();
     if(_readingThread.joinable()) _readingThread.join();
+    if(_callbackId >= 0) {
+        _daiMessageQueue->removeCallback(_callbackId);
+    }
+    if(_strand) {
+        _strand->close();
+    }
 }
 
 }  // namespace ros
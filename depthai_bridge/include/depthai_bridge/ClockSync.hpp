@@ -0,0 +1,106 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "rclcpp/clock.hpp"
+#include "rclcpp/time.hpp"
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Maps the steady clock time points depthai stamps messages with to ROS time.
+ * The mapping is a line fitted over a window of (steady, ROS) clock samples, so it follows both the offset and the drift of the
+ * ROS clock against the steady clock. Converting a timestamp only reads the current fit, new samples are taken by update(),
+ * either called directly or periodically from the thread started with startUpdates().
+ */
+class ClockSync {
+   public:
+    using SteadyTimePoint = std::chrono::time_point<std::chrono::steady_clock>;
+
+    /**
+     * @param windowSize: Number of most recent samples the fit is computed from.
+     */
+    explicit ClockSync(size_t windowSize = 20);
+    ~ClockSync();
+    ClockSync(const ClockSync&) = delete;
+    ClockSync& operator=(const ClockSync&) = delete;
+
+    /**
+     * @brief Instance shared by the converters of one device, so all its streams are stamped with the same mapping while
+     * other devices in the process keep their own. Created on first use and destroyed together with the last converter holding it.
+     * @param deviceId: MxId of the device, converters that do not know their device share the instance of the empty id.
+     */
+    static std::shared_ptr<ClockSync> getInstance(const std::string& deviceId = "");
+
+    /**
+     * @brief Converts a message timestamp to ROS time. Lock free, safe to call from any thread.
+     */
+    rclcpp::Time toRosTime(SteadyTimePoint timePoint) const;
+
+    /**
+     * @brief Samples both clocks and refits the mapping. Jumps of the ROS clock restart the window.
+     */
+    void update();
+
+    /**
+     * @brief Adds a sample of both clocks taken elsewhere and refits the mapping, handled the same way as the samples of update().
+     * @param steadyTime: Steady clock time the ROS time was read at.
+     * @param rosTime: ROS time at that moment.
+     */
+    void addSample(SteadyTimePoint steadyTime, const rclcpp::Time& rosTime);
+
+    /**
+     * @brief Calls update() periodically from a background thread, does nothing if already running.
+     * @param period: Time between two samples.
+     */
+    void startUpdates(std::chrono::milliseconds period = std::chrono::milliseconds(500));
+    void stopUpdates();
+
+    /**
+     * @brief Current drift estimate, nanoseconds the ROS clock gains on the steady clock per nanosecond.
+     */
+    double getDrift() const;
+
+   private:
+    struct Sample {
+        int64_t steadyNs;
+        int64_t offsetNs;
+    };
+    void addSampleLocked(int64_t steadyNs, int64_t rosNs);
+    void fit();
+    void storeFit(int64_t baseSteadyNs, int64_t baseOffsetNs, double drift);
+
+    // Fit parameters guarded by a sequence lock, readers retry if an update happened while they were reading.
+    std::atomic<uint64_t> _sequence{0};
+    std::atomic<int64_t> _baseSteadyNs{0};
+    std::atomic<int64_t> _baseOffsetNs{0};
+    std::atomic<double> _drift{0.0};
+
+    std::mutex _updateMutex;
+    rclcpp::Clock _rosClock;
+    std::deque<Sample> _samples;
+    size_t _windowSize;
+    // For handling ROS time shifts and debugging
+    int64_t _totalNsChange{0};
+
+    std::mutex _threadMutex;
+    std::condition_variable _threadCv;
+    std::thread _updateThread;
+    bool _running = false;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
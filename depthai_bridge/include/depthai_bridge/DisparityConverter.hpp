@@ -5,6 +5,7 @@
 #include <string>
 
 #include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai_bridge/ClockSync.hpp"
 #include "rclcpp/time.hpp"
 #include "sensor_msgs/image_encodings.hpp"
 #include "stereo_msgs/msg/disparity_image.hpp"
@@ -35,27 +36,39 @@ class DisparityConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
+    /**
+     * @brief Sets the number of fractional bits of 16 bit subpixel disparity, as configured on the StereoDepth node. RAW8 disparity
+     * has none and is not affected.
+     *
+     * @param bits: Subpixel fractional bits, 3 by default on the device
+     */
+    void setSubpixelFractionalBits(int bits);
+
     void toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::deque<DisparityMsgs::DisparityImage>& outImageMsg);
     DisparityImagePtr toRosMsgPtr(std::shared_ptr<dai::ImgFrame> inData);
 
    private:
     const std::string _frameName = "";
     const float _focalLength = 882.2, _baseline = 7.5, _minDepth = 80, _maxDepth;
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
-    rclcpp::Time _rosBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
+    int _subpixelFractionalBits = 3;
 };
 
 }  // namespace ros
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Widens 8 bit disparity to float, dst[i] = src[i].
+ * Uses SSE4.1/AVX2 on x86 or NEON on ARM hosts, picked at runtime, and falls back to a scalar loop otherwise.
+ * @param src: RAW8 disparity.
+ * @param dst: Output buffer, must hold numPixels floats.
+ * @param numPixels: Number of pixels to convert.
+ */
+void disparityToFloat(const uint8_t* src, float* dst, size_t numPixels);
+
+/**
+ * @brief Converts 16 bit subpixel disparity to float, dst[i] = src[i] * scale. The scale is 1 / 2^fractionalBits, a power of two,
+ * so every kernel produces exactly the same result as the scalar loop.
+ * @param src: RAW16 disparity, may be unaligned.
+ * @param dst: Output buffer, must hold numPixels floats.
+ * @param numPixels: Number of pixels to convert.
+ * @param scale: Factor applied to every value.
+ */
+void subpixelDisparityToFloat(const int16_t* src, float* dst, size_t numPixels, float scale);
+
+/**
+ * @brief Name of the kernel set selected for this host, one of "avx2", "sse4.1", "neon" or "scalar".
+ */
+const char* disparityKernelName();
+
+/**
+ * @brief One set of conversion kernels, exposed so tests and benchmarks can run each set and not only the selected one.
+ */
+struct DisparityKernelSet {
+    const char* name;
+    void (*toFloat)(const uint8_t* src, float* dst, size_t numPixels);
+    void (*subpixelToFloat)(const int16_t* src, float* dst, size_t numPixels, float scale);
+};
+
+/**
+ * @brief Kernel sets this host can run, ordered from slowest to fastest. The first one is always "scalar", the last one is what
+ * disparityToFloat() and subpixelDisparityToFloat() use.
+ */
+std::vector<DisparityKernelSet> supportedDisparityKernels();
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
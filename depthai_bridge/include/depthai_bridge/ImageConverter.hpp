@@ -5,14 +5,21 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "cv_bridge/cv_bridge.h"
 #include "depthai-shared/common/CameraBoardSocket.hpp"
 #include "depthai-shared/common/Point2f.hpp"
+#include "depthai-shared/properties/VideoEncoderProperties.hpp"
 #include "depthai/device/CalibrationHandler.hpp"
 #include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai_bridge/ClockSync.hpp"
+#include "depthai_bridge/JpegDecoder.hpp"
+#include "depthai_bridge/VideoDecoder.hpp"
+#include "depthai_ros_msgs/msg/ffmpeg_packet.hpp"
 #include "rclcpp/time.hpp"
 #include "sensor_msgs/msg/camera_info.hpp"
+#include "sensor_msgs/msg/compressed_image.hpp"
 #include "sensor_msgs/msg/image.hpp"
 #include "std_msgs/msg/header.hpp"
 
@@ -26,6 +33,15 @@ using ImagePtr = ImageMsgs::Image::SharedPtr;
 
 using TimePoint = std::chrono::time_point<std::chrono::steady_clock, std::chrono::steady_clock::duration>;
 
+/**
+ * Encodings of YUV 4:2:0 frames published without conversion, see ImageConverter::setNativeYUV, sensor_msgs has none for them.
+ * The luma plane is followed by the chroma of the same frame, all rows are width bytes, so the message height is 3/2 of the
+ * image height and step * height covers the whole buffer. NV12 chroma is one plane of interleaved U/V pairs, YUV420 (I420)
+ * chroma is a U plane followed by a V plane, each width/2 x height/2 packed two rows per message row.
+ */
+constexpr char NV12_ENCODING[] = "nv12";
+constexpr char YUV420_ENCODING[] = "YUV420";
+
 class ImageConverter {
    public:
     // ImageConverter() = default;
@@ -42,12 +58,20 @@ class ImageConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
     /**
@@ -56,6 +80,20 @@ class ImageConverter {
      */
     void convertFromBitstream(dai::RawImgFrame::Type srcType);
 
+    /**
+     * @brief Sets converter behavior to convert from bitstream produced with the given encoder profile.
+     * H.264/H.265 frames are decoded with VideoDecoder, which needs the bridge to be built with libavcodec.
+     * @param srcType: The type of the bitstream data used for conversion.
+     * @param profile: Profile the VideoEncoder node was configured with.
+     */
+    void convertFromBitstream(dai::RawImgFrame::Type srcType, dai::VideoEncoderProperties::Profile profile);
+
+    /**
+     * @brief Decodes bitstream frames at reduced resolution, CameraInfo passed to the converter should match the reduced size.
+     * @param scale: Downscaling factor, 1, 2, 4 or 8.
+     */
+    void setDecodeScale(int scale);
+
     /**
      * @brief Sets exposure offset when getting timestamps from the message.
      * @param offset: The exposure offset to be added to the timestamp.
@@ -73,22 +111,58 @@ class ImageConverter {
      * By default the right socket is used as the base, calling this function will set left as base.
      */
     void reverseStereoSocketOrder();
+    bool isStereoSocketOrderReversed() const;
 
     /**
      * @brief Sets the alpha scaling factor for the image.
      * @param alphaScalingFactor: The alpha scaling factor to be used.
      */
     void setAlphaScaling(double alphaScalingFactor = 0.0);
+    bool isAlphaScalingEnabled() const;
+    double getAlphaScalingFactor() const;
+
+    /**
+     * @brief Publishes NV12 and YUV420p frames as they come from the device instead of converting them to bgr8.
+     * Messages get the NV12_ENCODING or YUV420_ENCODING layout, with height 3/2 of the image height.
+     * @param nativeYUV: Whether to skip the conversion.
+     */
+    void setNativeYUV(bool nativeYUV = true);
 
     void toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::deque<ImageMsgs::Image>& outImageMsgs);
     ImageMsgs::Image toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> inData, const sensor_msgs::msg::CameraInfo& info = sensor_msgs::msg::CameraInfo());
     ImagePtr toRosMsgPtr(std::shared_ptr<dai::ImgFrame> inData);
 
+    /**
+     * @brief Converts the frame directly into a heap allocated message that can be handed to a publisher without further copies.
+     * Interleaved frames have their payload moved out of inData, so the frame must not be read again after this call.
+     * For H.264/H.265 input nullptr is returned while the decoder waits for a keyframe, toRosMsgPtr behaves the same way.
+     * @param inData: The frame to convert.
+     * @param info: CameraInfo of the stream, used when converting disparity to depth.
+     */
+    ImageMsgs::Image::UniquePtr toRosMsgUniquePtr(std::shared_ptr<dai::ImgFrame> inData,
+                                                  const sensor_msgs::msg::CameraInfo& info = sensor_msgs::msg::CameraInfo());
+
+    /**
+     * @brief Wraps the encoded frame in a CompressedImage without decoding it, only valid in convertFromBitstream mode.
+     * The bitstream is moved out of inData, so run any raw conversion of the same frame first.
+     * @param inData: Encoded frame coming from a VideoEncoder node.
+     */
+    ImageMsgs::CompressedImage::UniquePtr toRosCompressedMsg(std::shared_ptr<dai::ImgFrame> inData);
+
+    /**
+     * @brief Wraps an H.264/H.265 access unit in an FFMPEGPacket without decoding it, flagging keyframes.
+     * The bitstream is moved out of inData, so run any raw conversion of the same frame first.
+     * @param inData: Encoded frame coming from a VideoEncoder node configured with an H.264/H.265 profile.
+     */
+    depthai_ros_msgs::msg::FFMPEGPacket::UniquePtr toRosFFMPEGPacket(std::shared_ptr<dai::ImgFrame> inData);
+
     void toDaiMsg(const ImageMsgs::Image& inMsg, dai::ImgFrame& outData);
 
-    /** TODO(sachin): Add support for ros msg to cv mat since we have some
-     *  encodings which cv supports but ros doesn't
-     **/
+    /**
+     * @brief Converts a message to a BGR Mat, including YUV encodings cv_bridge does not know about.
+     * bgr8 and mono8 messages are wrapped without copying, so the Mat is only valid as long as inMsg.
+     * @param inMsg: Message to convert.
+     */
     cv::Mat rosMsgtoCvMat(ImageMsgs::Image& inMsg);
 
     ImageMsgs::CameraInfo calibrationToCameraInfo(dai::CalibrationHandler calibHandler,
@@ -106,24 +180,37 @@ class ImageConverter {
     bool _daiInterleaved;
     // bool c
     const std::string _frameName = "";
+    StdMsgs::Header getFrameHeader(std::shared_ptr<dai::ImgFrame> inData);
+    /**
+     * @return false if no image was produced, only happens for H.264/H.265 input while waiting for a keyframe.
+     */
+    bool fillRosMsg(std::shared_ptr<dai::ImgFrame> inData, const sensor_msgs::msg::CameraInfo& info, ImageMsgs::Image& outImageMsg);
+    bool isVideoBitstream() const;
+    /**
+     * Disparity to depth lookup, one entry per 8 bit disparity value. Rebuilt only when the focal length or baseline change.
+     */
+    const std::vector<uint16_t>& getDispToDepthLUT(double focalLength);
     void planarToInterleaved(const std::vector<uint8_t>& srcData, std::vector<uint8_t>& destData, int w, int h, int numPlanes, int bpp);
     void interleavedToPlanar(const std::vector<uint8_t>& srcData, std::vector<uint8_t>& destData, int w, int h, int numPlanes, int bpp);
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
 
-    rclcpp::Time _rosBaseTime;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
     dai::RawImgFrame::Type _srcType;
     bool _fromBitstream = false;
+    dai::VideoEncoderProperties::Profile _bitstreamProfile = dai::VideoEncoderProperties::Profile::MJPEG;
+    JpegDecoder _jpegDecoder;
+    VideoDecoder _videoDecoder;
+    int64_t _lastVideoSequenceNum = -1;
     bool _convertDispToDepth = false;
     bool _addExpOffset = false;
     bool _alphaScalingEnabled = false;
+    bool _nativeYUV = false;
     dai::CameraExposureOffset _expOffset;
     bool _reverseStereoSocketOrder = false;
     double _baseline;
+    std::vector<uint16_t> _dispToDepthLUT;
+    double _lutFocalLength = 0.0;
+    double _lutBaseline = 0.0;
     double _alphaScalingFactor = 0.0;
 };
 
@@ -1,15 +1,23 @@
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 
 #include "depthai-shared/datatype/RawIMUData.hpp"
 #include "depthai/pipeline/datatype/IMUData.hpp"
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai_bridge/ClockSync.hpp"
+#include "depthai_bridge/RingBuffer.hpp"
 #include "depthai_bridge/depthaiUtility.hpp"
+#include "depthai_ros_msgs/msg/imu_batch.hpp"
+#include "depthai_ros_msgs/msg/imu_frame_bundle.hpp"
 #include "depthai_ros_msgs/msg/imu_with_magnetic_field.hpp"
 #include "rclcpp/time.hpp"
 #include "sensor_msgs/msg/imu.hpp"
@@ -46,17 +54,63 @@ class ImuConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
+    /**
+     * @brief Sizes the interpolation history to one second of reports at the highest of the configured sensor rates.
+     * Older reports are dropped if a sensor stops reporting, instead of the history growing.
+     *
+     * @param accelFreq: Accelerometer rate in Hz
+     * @param gyroFreq: Gyroscope rate in Hz
+     * @param rotationFreq: Rotation vector rate in Hz, 0 if disabled
+     * @param magnFreq: Magnetometer rate in Hz, 0 if disabled
+     */
+    void setSensorRates(int accelFreq, int gyroFreq, int rotationFreq = 0, int magnFreq = 0);
+
     void toRosMsg(std::shared_ptr<dai::IMUData> inData, std::deque<ImuMsgs::Imu>& outImuMsgs);
     void toRosDaiMsg(std::shared_ptr<dai::IMUData> inData, std::deque<depthai_ros_msgs::msg::ImuWithMagneticField>& outImuMsgs);
 
+    /**
+     * @brief Converts all samples of a device packet into a single message, magnetic field is filled if magnetometer is enabled.
+     * Shares the interpolation history with toRosMsg and toRosDaiMsg, so a converter should only feed one of them.
+     */
+    void toRosBatchMsg(std::shared_ptr<dai::IMUData> inData, depthai_ros_msgs::msg::ImuBatch& outBatch);
+
+    /**
+     * @brief Keeps the samples produced by the conversions above, so they can be attached to camera frames with toRosFrameBundle.
+     *
+     * @param enable: bool whether to keep samples for frame bundles
+     * @param preintegrate: bool whether bundles also carry rotation, velocity and position deltas integrated from their samples
+     * @param maxWait: How long toRosFrameBundle waits for the IMU samples of a frame to be converted
+     */
+    void setFrameBundling(bool enable, bool preintegrate = false, std::chrono::milliseconds maxWait = std::chrono::milliseconds(50));
+
+    /**
+     * @brief Moves all kept samples stamped up to the camera frame into a bundle. Safe to call from a different thread than the
+     * IMU conversions, and must be, as it blocks until a sample stamped at or after the frame was converted or maxWait passed.
+     * Only then all samples of the interval are in, interpolation holds back the newest report until the next one arrives.
+     * On timeout the bundle is built from what is there and the last sample is held until the frame stamp when preintegrating.
+     * Samples that arrive after their frame was bundled go into the next bundle, so none are lost or repeated.
+     *
+     * @param inData: Camera frame, stamped the same way as the IMU samples
+     * @param outBundle: Receives the samples, and the preintegrated deltas if enabled
+     */
+    void toRosFrameBundle(std::shared_ptr<dai::ImgFrame> inData, depthai_ros_msgs::msg::ImuFrameBundle& outBundle);
+
     template <typename T>
     T lerp(const T& a, const T& b, const double t) {
         return a * (1.0 - t) + b * t;
@@ -74,67 +128,62 @@ class ImuConverter {
    private:
     template <typename T>
     void FillImuData_LinearInterpolation(std::vector<IMUPacket>& imuPackets, std::deque<T>& imuMsgs) {
-        static std::deque<dai::IMUReportAccelerometer> accelHist;
-        static std::deque<dai::IMUReportGyroscope> gyroHist;
-        static std::deque<dai::IMUReportRotationVectorWAcc> rotationHist;
-        static std::deque<dai::IMUReportMagneticField> magnHist;
-
         for(int i = 0; i < imuPackets.size(); ++i) {
-            if(accelHist.size() == 0) {
-                accelHist.push_back(imuPackets[i].acceleroMeter);
-            } else if(accelHist.back().sequence != imuPackets[i].acceleroMeter.sequence) {
-                accelHist.push_back(imuPackets[i].acceleroMeter);
+            if(_accelHist.size() == 0) {
+                _accelHist.push_back(imuPackets[i].acceleroMeter);
+            } else if(_accelHist.back().sequence != imuPackets[i].acceleroMeter.sequence) {
+                _accelHist.push_back(imuPackets[i].acceleroMeter);
             }
 
-            if(gyroHist.size() == 0) {
-                gyroHist.push_back(imuPackets[i].gyroscope);
-            } else if(gyroHist.back().sequence != imuPackets[i].gyroscope.sequence) {
-                gyroHist.push_back(imuPackets[i].gyroscope);
+            if(_gyroHist.size() == 0) {
+                _gyroHist.push_back(imuPackets[i].gyroscope);
+            } else if(_gyroHist.back().sequence != imuPackets[i].gyroscope.sequence) {
+                _gyroHist.push_back(imuPackets[i].gyroscope);
             }
 
-            if(_enable_rotation && rotationHist.size() == 0) {
-                rotationHist.push_back(imuPackets[i].rotationVector);
-            } else if(_enable_rotation && rotationHist.back().sequence != imuPackets[i].rotationVector.sequence) {
-                rotationHist.push_back(imuPackets[i].rotationVector);
+            if(_enable_rotation && _rotationHist.size() == 0) {
+                _rotationHist.push_back(imuPackets[i].rotationVector);
+            } else if(_enable_rotation && _rotationHist.back().sequence != imuPackets[i].rotationVector.sequence) {
+                _rotationHist.push_back(imuPackets[i].rotationVector);
             } else {
-                rotationHist.resize(accelHist.size());
+                _rotationHist.resize(_accelHist.size());
             }
 
-            if(_enable_magn && magnHist.size() == 0) {
-                magnHist.push_back(imuPackets[i].magneticField);
-            } else if(_enable_magn && magnHist.back().sequence != imuPackets[i].magneticField.sequence) {
-                magnHist.push_back(imuPackets[i].magneticField);
+            if(_enable_magn && _magnHist.size() == 0) {
+                _magnHist.push_back(imuPackets[i].magneticField);
+            } else if(_enable_magn && _magnHist.back().sequence != imuPackets[i].magneticField.sequence) {
+                _magnHist.push_back(imuPackets[i].magneticField);
             } else {
-                magnHist.resize(accelHist.size());
+                _magnHist.resize(_accelHist.size());
             }
 
             if(_syncMode == ImuSyncMethod::LINEAR_INTERPOLATE_ACCEL) {
-                if(accelHist.size() < 3 && gyroHist.size() && rotationHist.size() && magnHist.size()) {
+                if(_accelHist.size() < 3 && _gyroHist.size() && _rotationHist.size() && _magnHist.size()) {
                     continue;
                 } else {
                     if(_enable_rotation) {
                         if(_enable_magn) {
-                            interpolate(accelHist, gyroHist, rotationHist, magnHist, imuMsgs);
+                            interpolate(_accelHist, _gyroHist, _rotationHist, _magnHist, imuMsgs);
                         } else {
-                            interpolate(accelHist, gyroHist, rotationHist, imuMsgs);
+                            interpolate(_accelHist, _gyroHist, _rotationHist, imuMsgs);
                         }
                     } else {
-                        interpolate(accelHist, gyroHist, imuMsgs);
+                        interpolate(_accelHist, _gyroHist, imuMsgs);
                     }
                 }
 
             } else if(_syncMode == ImuSyncMethod::LINEAR_INTERPOLATE_GYRO) {
-                if(gyroHist.size() < 3 && accelHist.size() && rotationHist.size() && magnHist.size()) {
+                if(_gyroHist.size() < 3 && _accelHist.size() && _rotationHist.size() && _magnHist.size()) {
                     continue;
                 } else {
                     if(_enable_rotation) {
                         if(_enable_magn) {
-                            interpolate(gyroHist, accelHist, rotationHist, magnHist, imuMsgs);
+                            interpolate(_gyroHist, _accelHist, _rotationHist, _magnHist, imuMsgs);
                         } else {
-                            interpolate(gyroHist, accelHist, rotationHist, imuMsgs);
+                            interpolate(_gyroHist, _accelHist, _rotationHist, imuMsgs);
                         }
                     } else {
-                        interpolate(gyroHist, accelHist, imuMsgs);
+                        interpolate(_gyroHist, _accelHist, imuMsgs);
                     }
                 }
             }
@@ -147,13 +196,26 @@ class ImuConverter {
     bool _enable_magn;
     const std::string _frameName = "";
     ImuSyncMethod _syncMode;
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
-    rclcpp::Time _rosBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
+    // Interpolation history, kept per converter so converters of different devices do not mix their reports.
+    RingBuffer<dai::IMUReportAccelerometer> _accelHist;
+    RingBuffer<dai::IMUReportGyroscope> _gyroHist;
+    RingBuffer<dai::IMUReportRotationVectorWAcc> _rotationHist;
+    RingBuffer<dai::IMUReportMagneticField> _magnHist;
+
+    // Converted samples waiting for their camera frame, filled by the IMU thread and drained by the frame thread.
+    bool _frameBundling = false;
+    bool _preintegrate = false;
+    std::chrono::milliseconds _bundleMaxWait{50};
+    std::mutex _bundleMutex;
+    std::condition_variable _bundleCv;
+    RingBuffer<ImuMsgs::Imu> _bundleSamples;
+    int64_t _lastBundleStampNs = 0;
+    int64_t _newestSampleNs = 0;
+
+    void keepForBundle(const ImuMsgs::Imu& msg);
+    void preintegrate(depthai_ros_msgs::msg::ImuFrameBundle& bundle, int64_t startNs, int64_t endNs);
 
     void fillImuMsg(ImuMsgs::Imu& msg, dai::IMUReportAccelerometer report);
     void fillImuMsg(ImuMsgs::Imu& msg, dai::IMUReportGyroscope report);
@@ -174,7 +236,7 @@ class ImuConverter {
 
         msg.header.frame_id = _frameName;
 
-        msg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, timestamp);
+        msg.header.stamp = _clockSync->toRosTime(timestamp);
     }
 
     template <typename I, typename S, typename T, typename M>
@@ -185,7 +247,7 @@ class ImuConverter {
 
         msg.header.frame_id = _frameName;
 
-        msg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, timestamp);
+        msg.header.stamp = _clockSync->toRosTime(timestamp);
     }
 
     template <typename I, typename S, typename M>
@@ -195,11 +257,11 @@ class ImuConverter {
 
         msg.header.frame_id = _frameName;
 
-        msg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, timestamp);
+        msg.header.stamp = _clockSync->toRosTime(timestamp);
     }
 
     template <typename I, typename S, typename M>
-    void interpolate(std::deque<I>& interpolated, std::deque<S>& second, std::deque<M>& imuMsgs) {
+    void interpolate(RingBuffer<I>& interpolated, RingBuffer<S>& second, std::deque<M>& imuMsgs) {
         I interp0, interp1;
         S currSecond;
         interp0.sequence = -1;
@@ -250,7 +312,7 @@ class ImuConverter {
     }
 
     template <typename I, typename S, typename T, typename M>
-    void interpolate(std::deque<I>& interpolated, std::deque<S>& second, std::deque<T>& third, std::deque<M>& imuMsgs) {
+    void interpolate(RingBuffer<I>& interpolated, RingBuffer<S>& second, RingBuffer<T>& third, std::deque<M>& imuMsgs) {
         I interp0, interp1;
         S currSecond;
         T currThird;
@@ -305,7 +367,7 @@ class ImuConverter {
     }
 
     template <typename I, typename S, typename T, typename F, typename M>
-    void interpolate(std::deque<I>& interpolated, std::deque<S>& second, std::deque<T>& third, std::deque<F>& fourth, std::deque<M>& imuMsgs) {
+    void interpolate(RingBuffer<I>& interpolated, RingBuffer<S>& second, RingBuffer<T>& third, RingBuffer<F>& fourth, std::deque<M>& imuMsgs) {
         I interp0, interp1;
         S currSecond;
         T currThird;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "opencv2/core/mat.hpp"
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Decodes MJPEG bitstream frames while reusing its buffers between frames.
+ * Copies of a decoder start with their own empty buffers, so converters bound into several callbacks never share them.
+ */
+class JpegDecoder {
+   public:
+    explicit JpegDecoder(int scale = 1);
+    JpegDecoder(const JpegDecoder& other);
+    JpegDecoder& operator=(const JpegDecoder& other);
+    ~JpegDecoder();
+
+    /**
+     * @brief Sets the downscaling applied while decoding, done in the DCT domain so it is cheaper than a full decode.
+     * @param scale: 1, 2, 4 or 8.
+     */
+    void setScale(int scale);
+    int getScale() const;
+
+    /**
+     * @brief Reads the image size from the SOF marker of a JPEG stream without decoding it.
+     * @return false if no frame header was found.
+     */
+    static bool readSize(const uint8_t* data, size_t size, int& width, int& height);
+
+    /**
+     * @brief Decodes into the decoder's internal buffer. The returned Mat is only valid until the next decode call.
+     * @param data: JPEG stream.
+     * @param flags: cv::ImreadModes used for decoding, scale related flags are added by the decoder.
+     */
+    const cv::Mat& decode(const std::vector<uint8_t>& data, int flags);
+
+    /**
+     * @brief Decodes straight into outData, e.g. the data field of an outgoing message, sizing it from the stream header.
+     * @param data: JPEG stream.
+     * @param flags: cv::ImreadModes used for decoding, scale related flags are added by the decoder.
+     * @param cvType: Type of the decoded image for the given flags, e.g. CV_8UC3 for cv::IMREAD_COLOR.
+     * @param outData: Receives the packed decoded pixels.
+     * @param width: Receives the decoded width.
+     * @param height: Receives the decoded height.
+     */
+    void decodeInto(const std::vector<uint8_t>& data, int flags, int cvType, std::vector<uint8_t>& outData, int& width, int& height);
+
+   private:
+    int scaledFlags(int flags) const;
+    int _scale = 1;
+    cv::Mat _buffer;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
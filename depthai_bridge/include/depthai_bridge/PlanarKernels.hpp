@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Packs three 8 bit planes into an interleaved 3 channel buffer, dst[3 * i + c] = plane_c[i].
+ * Uses SSSE3/AVX2 on x86 or NEON on ARM hosts, picked at runtime, and falls back to a scalar loop otherwise.
+ * @param plane0: Plane written to channel 0 of the output.
+ * @param plane1: Plane written to channel 1 of the output.
+ * @param plane2: Plane written to channel 2 of the output.
+ * @param dst: Output buffer, must hold 3 * numPixels bytes.
+ * @param numPixels: Number of pixels in each plane.
+ */
+void interleavePlanes(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels);
+
+/**
+ * @brief Splits an interleaved 3 channel buffer into three 8 bit planes, plane_c[i] = src[3 * i + c].
+ * @param src: Interleaved input, must hold 3 * numPixels bytes.
+ * @param plane0: Receives channel 0 of the input.
+ * @param plane1: Receives channel 1 of the input.
+ * @param plane2: Receives channel 2 of the input.
+ * @param numPixels: Number of pixels in each plane.
+ */
+void deinterleavePlanes(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels);
+
+/**
+ * @brief Name of the kernel set selected for this host, one of "avx2", "ssse3", "neon" or "scalar".
+ */
+const char* planarKernelName();
+
+/**
+ * @brief One set of conversion kernels, exposed so tests and benchmarks can run each set and not only the selected one.
+ */
+struct PlanarKernelSet {
+    const char* name;
+    void (*interleave)(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels);
+    void (*deinterleave)(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels);
+};
+
+/**
+ * @brief Kernel sets this host can run, ordered from slowest to fastest. The first one is always "scalar", the last one is what
+ * interleavePlanes() and deinterleavePlanes() use.
+ */
+std::vector<PlanarKernelSet> supportedPlanarKernels();
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
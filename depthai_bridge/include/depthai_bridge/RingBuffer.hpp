@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Fixed capacity FIFO with the deque operations the converters use. Storage is allocated when the capacity is set, so
+ * pushing and popping never allocate. When full, push_back overwrites the oldest element.
+ */
+template <typename T>
+class RingBuffer {
+   public:
+    explicit RingBuffer(size_t capacity = 0) {
+        setCapacity(capacity);
+    }
+
+    /**
+     * @brief Reallocates the storage, keeping the newest elements that fit.
+     */
+    void setCapacity(size_t capacity) {
+        std::vector<T> storage(capacity);
+        size_t keep = _size < capacity ? _size : capacity;
+        for(size_t i = 0; i < keep; i++) {
+            storage[i] = at(_size - keep + i);
+        }
+        _storage.swap(storage);
+        _head = 0;
+        _size = keep;
+    }
+
+    size_t capacity() const {
+        return _storage.size();
+    }
+    size_t size() const {
+        return _size;
+    }
+    bool empty() const {
+        return _size == 0;
+    }
+    bool full() const {
+        return _size == _storage.size();
+    }
+
+    T& front() {
+        return _storage[_head];
+    }
+    const T& front() const {
+        return _storage[_head];
+    }
+    T& back() {
+        return at(_size - 1);
+    }
+    const T& back() const {
+        return at(_size - 1);
+    }
+    T& at(size_t index) {
+        return _storage[(_head + index) % _storage.size()];
+    }
+    const T& at(size_t index) const {
+        return _storage[(_head + index) % _storage.size()];
+    }
+
+    void push_back(const T& value) {
+        if(_storage.empty()) {
+            throw std::runtime_error("RingBuffer has no capacity");
+        }
+        if(full()) {
+            pop_front();
+            _droppedCount++;
+        }
+        _storage[(_head + _size) % _storage.size()] = value;
+        _size++;
+    }
+
+    void pop_front() {
+        _head = (_head + 1) % _storage.size();
+        _size--;
+    }
+
+    /**
+     * @brief Grows with default constructed elements or shrinks from the back, bounded by the capacity.
+     */
+    void resize(size_t size) {
+        if(size > _storage.size()) {
+            size = _storage.size();
+        }
+        while(_size < size) {
+            _storage[(_head + _size) % _storage.size()] = T();
+            _size++;
+        }
+        _size = size;
+    }
+
+    void clear() {
+        _head = 0;
+        _size = 0;
+    }
+
+    /**
+     * @brief Number of elements overwritten because the buffer was full.
+     */
+    uint64_t getDroppedCount() const {
+        return _droppedCount;
+    }
+
+   private:
+    std::vector<T> _storage;
+    size_t _head = 0;
+    size_t _size = 0;
+    uint64_t _droppedCount = 0;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "depthai/pipeline/datatype/SpatialImgDetections.hpp"
+#include "depthai_bridge/ClockSync.hpp"
 #include "depthai_ros_msgs/msg/spatial_detection_array.hpp"
 #include "rclcpp/time.hpp"
 #include "vision_msgs/msg/detection3_d_array.hpp"
@@ -30,31 +31,49 @@ class SpatialDetectionConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
     void toRosMsg(std::shared_ptr<dai::SpatialImgDetections> inNetData, std::deque<SpatialMessages::SpatialDetectionArray>& opDetectionMsg);
+
+    /**
+     * @brief Fills a caller owned message in place, allocating it if empty. Passing the same message again reuses the memory of
+     * its detections, and the message can be published by moving it out.
+     */
+    void toRosMsgInPlace(std::shared_ptr<dai::SpatialImgDetections> inNetData, std::unique_ptr<SpatialMessages::SpatialDetectionArray>& opDetectionMsg);
+
     void toRosVisionMsg(std::shared_ptr<dai::SpatialImgDetections> inNetData, std::deque<vision_msgs::msg::Detection3DArray>& opDetectionMsg);
 
+    /**
+     * @brief In place variant of toRosVisionMsg, reusing the message the same way as toRosMsgInPlace.
+     */
+    void toRosVisionMsgInPlace(std::shared_ptr<dai::SpatialImgDetections> inNetData, std::unique_ptr<vision_msgs::msg::Detection3DArray>& opDetectionMsg);
+
     SpatialDetectionArrayPtr toRosMsgPtr(std::shared_ptr<dai::SpatialImgDetections> inNetData);
 
    private:
+    void fillMsg(const std::shared_ptr<dai::SpatialImgDetections>& inNetData, SpatialMessages::SpatialDetectionArray& opDetectionMsg);
+    void fillVisionMsg(const std::shared_ptr<dai::SpatialImgDetections>& inNetData, vision_msgs::msg::Detection3DArray& opDetectionMsg);
+
     int _width, _height;
     const std::string _frameName;
     bool _normalized;
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
 
-    rclcpp::Time _rosBaseTime;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
 };
 
 /** TODO(sachin): Do we need to have ros msg -> dai bounding box ?
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "image_transport/camera_publisher.hpp"
+#include "image_transport/publisher.hpp"
+#include "rclcpp/node_interfaces/node_graph_interface.hpp"
+#include "rclcpp/publisher.hpp"
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Keeps a cached "has subscribers" flag per publisher, so lazy publishers can check for subscribers with a single atomic
+ * load instead of querying the ROS graph for every message. Flags are refreshed from a background thread whenever the graph of
+ * the node changes, i.e. when subscriptions appear or go away, and re-checked for a short settle time after each change to catch
+ * matches that complete after the graph event. While the graph is quiet the publishers are not queried at all.
+ */
+class SubscriptionTracker {
+   public:
+    /**
+     * @brief Cached subscription state, true while the tracked publisher has at least one subscriber.
+     * Tracking stops once the last copy of the flag is released.
+     */
+    using Flag = std::shared_ptr<const std::atomic<bool>>;
+
+    explicit SubscriptionTracker(rclcpp::node_interfaces::NodeGraphInterface::SharedPtr graph);
+    ~SubscriptionTracker();
+    SubscriptionTracker(const SubscriptionTracker&) = delete;
+    SubscriptionTracker& operator=(const SubscriptionTracker&) = delete;
+
+    /**
+     * @brief Tracker shared by everything publishing from the same node, so one thread serves all publishers of a node.
+     */
+    static std::shared_ptr<SubscriptionTracker> getInstance(rclcpp::node_interfaces::NodeGraphInterface::SharedPtr graph);
+
+    /**
+     * @brief Tracks an arbitrary subscription check, evaluated once immediately and again on every refresh.
+     */
+    Flag track(std::function<bool()> hasSubscribers);
+
+    /**
+     * @brief Tracks inter- and intra-process subscriptions of an rclcpp publisher.
+     */
+    template <typename MessageT>
+    Flag track(const std::shared_ptr<rclcpp::Publisher<MessageT>>& pub) {
+        std::weak_ptr<rclcpp::Publisher<MessageT>> weakPub = pub;
+        return track([weakPub]() {
+            auto pub = weakPub.lock();
+            return pub && (pub->get_subscription_count() > 0 || pub->get_intra_process_subscription_count() > 0);
+        });
+    }
+
+    /**
+     * @brief Tracks subscriptions of an image_transport publisher, counted over all of its transports.
+     */
+    Flag track(const image_transport::Publisher& pub);
+
+    /**
+     * @brief Tracks subscriptions of an image_transport camera publisher, counted over all of its transports.
+     */
+    Flag track(const image_transport::CameraPublisher& pub);
+
+   private:
+    struct Entry {
+        std::function<bool()> hasSubscribers;
+        std::weak_ptr<std::atomic<bool>> flag;
+    };
+    void refresh();
+    void run();
+
+    rclcpp::node_interfaces::NodeGraphInterface::SharedPtr _graph;
+    std::mutex _entriesMutex;
+    std::vector<Entry> _entries;
+    std::atomic<bool> _running{true};
+    std::thread _thread;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
@@ -1,4 +1,7 @@
 #pragma once
+#include <set>
+#include <string>
+
 #include "depthai-shared/common/CameraFeatures.hpp"
 #include "depthai/device/CalibrationHandler.hpp"
 #include "geometry_msgs/msg/quaternion.hpp"
@@ -29,7 +32,8 @@ class TFPublisher {
                          const std::string& customURDFLocation,
                          const std::string& customXacroArgs);
     /**
-     * @brief Obtain URDF description by running Xacro with provided arguments.
+     * @brief Obtain URDF description by running Xacro with provided arguments. Results are cached on disk in
+     * $ROS_HOME/depthai_urdf_cache, keyed by the arguments and the xacro files, so restarts with an unchanged setup skip Xacro.
      */
     std::string getURDF();
     geometry_msgs::msg::Quaternion quatFromRotM(nlohmann::json rotMatrix);
@@ -64,6 +68,21 @@ class TFPublisher {
      * @brief Check if model STL file is available in depthai_descriptions package.
      */
     bool modelNameAvailable();
+    /**
+     * @brief Run Xacro on the model file. Returns an empty string if Xacro fails.
+     */
+    std::string runXacro(const std::string& path, const std::string& args);
+    /**
+     * @brief Path of the cached URDF for the given model file and arguments. The key covers the contents of the model file and of
+     * every file it includes, so edited or reinstalled descriptions miss the cache. Empty if no cache directory is available.
+     */
+    std::string getURDFCachePath(const std::string& path, const std::string& args);
+    /**
+     * @brief Hashes a xacro file and, recursively, the files it includes. Include paths are resolved relative to the including file
+     * or through $(find <package>), includes built from other substitutions are only covered through the arguments.
+     */
+    bool hashXacroFile(const std::string& path, uint64_t& hash, std::set<std::string>& visited);
+    static void hashBytes(const std::string& data, uint64_t& hash);
     std::string getCamSocketName(int socketNum);
     std::unique_ptr<rclcpp::AsyncParametersClient> _paramClient;
     std::shared_ptr<tf2_ros::StaticTransformBroadcaster> _tfPub;
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "depthai/pipeline/datatype/Tracklets.hpp"
+#include "depthai_bridge/ClockSync.hpp"
 #include "depthai_ros_msgs/msg/track_detection2_d_array.hpp"
 #include "rclcpp/time.hpp"
 #include "vision_msgs/msg/detection2_d_array.hpp"
@@ -28,30 +29,41 @@ class TrackSpatialDetectionConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
     void toRosMsg(std::shared_ptr<dai::Tracklets> trackData, std::deque<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsgs);
 
+    /**
+     * @brief Fills a caller owned message in place, allocating it if empty. Passing the same message again reuses the memory of
+     * its detections, and the message can be published by moving it out.
+     */
+    void toRosMsgInPlace(std::shared_ptr<dai::Tracklets> trackData, std::unique_ptr<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsg);
+
     depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr toRosMsgPtr(std::shared_ptr<dai::Tracklets> trackData);
 
    private:
+    void fillMsg(const std::shared_ptr<dai::Tracklets>& trackData, depthai_ros_msgs::msg::TrackDetection2DArray& opDetectionMsg);
+
     int _width, _height;
     const std::string _frameName;
     bool _normalized;
     float _thresh;
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
-    rclcpp::Time _rosBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
 };
 
 }  // namespace ros
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <depthai_ros_msgs/msg/packed_tracked_features.hpp>
 #include <depthai_ros_msgs/msg/tracked_features.hpp>
 #include <deque>
 #include <memory>
 #include <string>
 
 #include "depthai/pipeline/datatype/TrackedFeatures.hpp"
+#include "depthai_bridge/ClockSync.hpp"
 #include "rclcpp/time.hpp"
 
 namespace dai {
@@ -27,25 +29,40 @@ class TrackedFeaturesConverter {
     void updateRosBaseTime();
 
     /**
-     * @brief Commands the converter to automatically update the ROS base time on message conversion based on variable
+     * @brief Commands the converter to keep the ROS base time updated. Updates are done periodically by the ClockSync shared
+     * between the converters of one device instead of on every message conversion. Without updates the converter keeps the
+     * mapping taken when this was called, or by the last updateRosBaseTime() call.
      *
-     * @param update: bool whether to automatically update the ROS base time on message conversion
+     * @param update: bool whether to automatically update the ROS base time
+     * @param deviceId: MxId of the device the converted messages come from
      */
-    void setUpdateRosBaseTimeOnToRosMsg(bool update = true) {
-        _updateRosBaseTimeOnToRosMsg = update;
+    void setUpdateRosBaseTimeOnToRosMsg(bool update = true, const std::string& deviceId = "") {
+        if(update) {
+            _clockSync = ClockSync::getInstance(deviceId);
+            _clockSync->startUpdates();
+        } else {
+            _clockSync = std::make_shared<ClockSync>();
+        }
     }
 
     void toRosMsg(std::shared_ptr<dai::TrackedFeatures> inFeatures, std::deque<depthai_ros_msgs::msg::TrackedFeatures>& featureMsgs);
 
+    /**
+     * @brief Converts to the packed message, which stores each feature field as its own array under a single header.
+     */
+    void toRosPackedMsg(std::shared_ptr<dai::TrackedFeatures> inFeatures, std::deque<depthai_ros_msgs::msg::PackedTrackedFeatures>& featureMsgs);
+
+    /**
+     * @brief Fills a caller owned packed message in place, allocating it if empty. Passing the same message again reuses its arrays.
+     */
+    void toRosPackedMsgInPlace(std::shared_ptr<dai::TrackedFeatures> inFeatures, std::unique_ptr<depthai_ros_msgs::msg::PackedTrackedFeatures>& featureMsg);
+
    private:
+    void fillPackedMsg(const std::shared_ptr<dai::TrackedFeatures>& inFeatures, depthai_ros_msgs::msg::PackedTrackedFeatures& featureMsg);
+
     const std::string _frameName;
-    std::chrono::time_point<std::chrono::steady_clock> _steadyBaseTime;
-    rclcpp::Time _rosBaseTime;
+    std::shared_ptr<ClockSync> _clockSync;
     bool _getBaseDeviceTimestamp;
-    // For handling ROS time shifts and debugging
-    int64_t _totalNsChange{0};
-    // Whether to update the ROS base time on each message conversion
-    bool _updateRosBaseTimeOnToRosMsg{false};
 };
 
 }  // namespace ros
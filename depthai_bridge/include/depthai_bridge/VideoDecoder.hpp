@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Software decoder for H.264/H.265 bitstream frames, backed by libavcodec when the bridge is built with it.
+ * Works on plain Annex-B byte packets, so it can be fed from a device queue as well as from recorded packet files.
+ * Copies of a decoder start with their own decoding context, so converters bound into several callbacks never share it.
+ */
+class VideoDecoder {
+   public:
+    enum class Codec { H264, H265 };
+
+    explicit VideoDecoder(Codec codec = Codec::H264);
+    VideoDecoder(const VideoDecoder& other);
+    VideoDecoder& operator=(const VideoDecoder& other);
+    ~VideoDecoder();
+
+    /**
+     * @brief Whether the bridge was built with libavcodec. If not, decodeInto throws.
+     */
+    static bool isAvailable();
+
+    /**
+     * @brief Checks whether an Annex-B packet contains an IDR (H.264) or IRAP (H.265) picture, i.e. decoding can start from it.
+     */
+    static bool isKeyframe(const uint8_t* data, size_t size, Codec codec);
+
+    void setCodec(Codec codec);
+    Codec getCodec() const;
+
+    /**
+     * @brief Sets the downscaling applied when converting decoded frames to the output format.
+     * @param scale: Downscaling factor, must be positive.
+     */
+    void setScale(int scale);
+    int getScale() const;
+
+    /**
+     * @brief Drops decoder state and skips packets until the next keyframe, e.g. after packets were lost or skipped.
+     */
+    void reset();
+
+    /**
+     * @brief Decodes a packet straight into outData, e.g. the data field of an outgoing message.
+     * @param data: Annex-B packet holding a single access unit.
+     * @param cvType: Output type, CV_8UC3 for BGR or CV_8UC1 for luma only.
+     * @param outData: Receives the packed decoded pixels.
+     * @param width: Receives the decoded width.
+     * @param height: Receives the decoded height.
+     * @return false if no frame was produced, either because the decoder waits for a keyframe or the packet was corrupt.
+     */
+    bool decodeInto(const std::vector<uint8_t>& data, int cvType, std::vector<uint8_t>& outData, int& width, int& height);
+
+   private:
+    struct Context;
+    void open();
+    Codec _codec;
+    int _scale = 1;
+    bool _waitForKeyframe = true;
+    std::unique_ptr<Context> _context;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace dai {
+
+namespace ros {
+
+/**
+ * @brief Fixed size pool of threads shared by publishers, so conversion work of all streams is bounded by the number of workers
+ * instead of one thread per stream. Tasks are picked by priority first and submission order second.
+ */
+class WorkerPool {
+   public:
+    enum class Priority { LOW, NORMAL, HIGH };
+
+    /**
+     * @brief Serializes tasks of one stream on the pool. At most one task of a strand runs at a time and tasks run in the order
+     * they were posted, so stateful converters need no locking. Only the oldest tasks are dropped when the stream falls behind.
+     */
+    class Strand : public std::enable_shared_from_this<Strand> {
+       public:
+        Strand(WorkerPool* pool, Priority priority, size_t maxPending);
+
+        /**
+         * @brief Queues a task, dropping the oldest pending one if maxPending tasks are already waiting.
+         */
+        void post(std::function<void()> task);
+
+        /**
+         * @brief Drops pending tasks and waits for the running one to finish, nothing is run afterwards.
+         * Must not be called from a task of the same strand.
+         */
+        void close();
+
+        /**
+         * @brief Number of tasks dropped because the stream fell behind.
+         */
+        uint64_t getDroppedCount() const;
+
+       private:
+        void runNext();
+
+        WorkerPool* _pool;
+        Priority _priority;
+        size_t _maxPending;
+        std::mutex _mutex;
+        std::condition_variable _idleCv;
+        std::deque<std::function<void()>> _pending;
+        bool _scheduled = false;
+        bool _running = false;
+        bool _closed = false;
+        std::atomic<uint64_t> _droppedCount{0};
+    };
+
+    /**
+     * @param numThreads: Number of worker threads, 0 uses one per hardware thread.
+     * @param cpuAffinity: CPUs to pin the workers to, worker i runs on cpuAffinity[i % size]. Empty leaves scheduling to the OS.
+     */
+    explicit WorkerPool(size_t numThreads = 0, std::vector<int> cpuAffinity = {});
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * @brief Pool shared by the publishers of the process, sized to the hardware. Created on first use.
+     */
+    static std::shared_ptr<WorkerPool> getInstance();
+
+    void submit(std::function<void()> task, Priority priority = Priority::NORMAL);
+
+    /**
+     * @brief Creates a strand running on this pool. The pool has to outlive the strand.
+     * @param maxPending: Number of tasks that may wait in the strand before the oldest are dropped.
+     */
+    std::shared_ptr<Strand> createStrand(Priority priority = Priority::NORMAL, size_t maxPending = 8);
+
+    size_t getNumThreads() const;
+
+   private:
+    struct Task {
+        Priority priority;
+        uint64_t sequence;
+        std::function<void()> function;
+    };
+    struct TaskOrder {
+        bool operator()(const Task& a, const Task& b) const;
+    };
+    void run();
+    void setAffinity(std::thread& thread, int cpu);
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::priority_queue<Task, std::vector<Task>, TaskOrder> _tasks;
+    uint64_t _sequence = 0;
+    bool _running = true;
+    std::vector<std::thread> _threads;
+};
+
+}  // namespace ros
+
+namespace rosBridge = ros;
+
+}  // namespace dai
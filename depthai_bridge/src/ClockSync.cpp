@@ -0,0 +1,157 @@
+#include "depthai_bridge/ClockSync.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <string>
+
+#include "depthai_bridge/depthaiUtility.hpp"
+
+namespace dai {
+
+namespace ros {
+
+// Offsets further off the fit than this are treated as a ROS time jump rather than noise or drift.
+static const int64_t TIME_JUMP_THRESHOLD_NS{1000000};
+
+ClockSync::ClockSync(size_t windowSize) : _windowSize(windowSize > 0 ? windowSize : 1) {
+    update();
+}
+
+ClockSync::~ClockSync() {
+    stopUpdates();
+}
+
+std::shared_ptr<ClockSync> ClockSync::getInstance(const std::string& deviceId) {
+    static std::mutex instancesMutex;
+    static std::map<std::string, std::weak_ptr<ClockSync>> instances;
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    for(auto it = instances.begin(); it != instances.end();) {
+        if(it->second.expired()) {
+            it = instances.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    auto clockSync = instances[deviceId].lock();
+    if(!clockSync) {
+        clockSync = std::make_shared<ClockSync>();
+        instances[deviceId] = clockSync;
+    }
+    return clockSync;
+}
+
+rclcpp::Time ClockSync::toRosTime(SteadyTimePoint timePoint) const {
+    int64_t steadyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch()).count();
+    uint64_t sequence;
+    int64_t baseSteadyNs, baseOffsetNs;
+    double drift;
+    do {
+        sequence = _sequence.load(std::memory_order_acquire);
+        baseSteadyNs = _baseSteadyNs.load(std::memory_order_relaxed);
+        baseOffsetNs = _baseOffsetNs.load(std::memory_order_relaxed);
+        drift = _drift.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while((sequence & 1) || sequence != _sequence.load(std::memory_order_relaxed));
+    return rclcpp::Time(steadyNs + baseOffsetNs + std::llround(drift * static_cast<double>(steadyNs - baseSteadyNs)));
+}
+
+void ClockSync::update() {
+    std::lock_guard<std::mutex> lock(_updateMutex);
+    // Steady time is taken on both sides of the ROS clock read so the sample is centered on it.
+    auto steadyBefore = std::chrono::steady_clock::now();
+    int64_t rosNs = _rosClock.now().nanoseconds();
+    auto steadyAfter = std::chrono::steady_clock::now();
+    int64_t steadyNs = std::chrono::duration_cast<std::chrono::nanoseconds>((steadyBefore + (steadyAfter - steadyBefore) / 2).time_since_epoch()).count();
+    addSampleLocked(steadyNs, rosNs);
+}
+
+void ClockSync::addSample(SteadyTimePoint steadyTime, const rclcpp::Time& rosTime) {
+    std::lock_guard<std::mutex> lock(_updateMutex);
+    addSampleLocked(std::chrono::duration_cast<std::chrono::nanoseconds>(steadyTime.time_since_epoch()).count(), rosTime.nanoseconds());
+}
+
+void ClockSync::addSampleLocked(int64_t steadyNs, int64_t rosNs) {
+    Sample sample{steadyNs, rosNs - steadyNs};
+
+    if(!_samples.empty()) {
+        int64_t predictedOffsetNs = _baseOffsetNs.load(std::memory_order_relaxed)
+                                    + std::llround(_drift.load(std::memory_order_relaxed) * (steadyNs - _baseSteadyNs.load(std::memory_order_relaxed)));
+        int64_t diff = sample.offsetNs - predictedOffsetNs;
+        if(std::abs(diff) > TIME_JUMP_THRESHOLD_NS) {
+            _totalNsChange += diff;
+            _samples.clear();
+            DEPTHAI_ROS_DEBUG_STREAM("ROS BASE TIME CHANGE: ",
+                                     "ROS base time changed by " << std::to_string(diff) << " ns. Total change: " << std::to_string(_totalNsChange) << " ns.");
+        }
+    }
+    _samples.push_back(sample);
+    while(_samples.size() > _windowSize) {
+        _samples.pop_front();
+    }
+    fit();
+}
+
+void ClockSync::fit() {
+    // Least squares line through offset over steady time, coordinates are taken relative to the first sample to keep precision.
+    const Sample& first = _samples.front();
+    double meanX = 0.0, meanY = 0.0;
+    for(const auto& sample : _samples) {
+        meanX += static_cast<double>(sample.steadyNs - first.steadyNs);
+        meanY += static_cast<double>(sample.offsetNs - first.offsetNs);
+    }
+    meanX /= _samples.size();
+    meanY /= _samples.size();
+    double sxx = 0.0, sxy = 0.0;
+    for(const auto& sample : _samples) {
+        double dx = static_cast<double>(sample.steadyNs - first.steadyNs) - meanX;
+        double dy = static_cast<double>(sample.offsetNs - first.offsetNs) - meanY;
+        sxx += dx * dx;
+        sxy += dx * dy;
+    }
+    double drift = sxx > 0.0 ? sxy / sxx : 0.0;
+    storeFit(first.steadyNs + std::llround(meanX), first.offsetNs + std::llround(meanY), drift);
+}
+
+void ClockSync::storeFit(int64_t baseSteadyNs, int64_t baseOffsetNs, double drift) {
+    _sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    _baseSteadyNs.store(baseSteadyNs, std::memory_order_relaxed);
+    _baseOffsetNs.store(baseOffsetNs, std::memory_order_relaxed);
+    _drift.store(drift, std::memory_order_relaxed);
+    _sequence.fetch_add(1, std::memory_order_release);
+}
+
+void ClockSync::startUpdates(std::chrono::milliseconds period) {
+    std::lock_guard<std::mutex> lock(_threadMutex);
+    if(_running) {
+        return;
+    }
+    _running = true;
+    _updateThread = std::thread([this, period]() {
+        std::unique_lock<std::mutex> threadLock(_threadMutex);
+        while(!_threadCv.wait_for(threadLock, period, [this]() { return !_running; })) {
+            threadLock.unlock();
+            update();
+            threadLock.lock();
+        }
+    });
+}
+
+void ClockSync::stopUpdates() {
+    {
+        std::lock_guard<std::mutex> lock(_threadMutex);
+        _running = false;
+    }
+    _threadCv.notify_all();
+    if(_updateThread.joinable()) {
+        _updateThread.join();
+    }
+}
+
+double ClockSync::getDrift() const {
+    return _drift.load(std::memory_order_relaxed);
+}
+
+}  // namespace ros
+}  // namespace dai
@@ -1,6 +1,12 @@
 
 #include "depthai_bridge/DisparityConverter.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "depthai_bridge/DisparityKernels.hpp"
 #include "depthai_bridge/depthaiUtility.hpp"
 
 namespace dai {
@@ -14,28 +20,32 @@ DisparityConverter::DisparityConverter(
       _baseline(baseline / 100.0),
       _minDepth(minDepth / 100.0),
       _maxDepth(maxDepth / 100.0),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 DisparityConverter::~DisparityConverter() = default;
 
 void DisparityConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
-void DisparityConverter::toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::deque<DisparityMsgs::DisparityImage>& outDispImageMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
+void DisparityConverter::setSubpixelFractionalBits(int bits) {
+    if(bits < 0 || bits > 5) {
+        throw std::runtime_error("Subpixel fractional bits must be between 0 and 5, got " + std::to_string(bits));
     }
+    _subpixelFractionalBits = bits;
+}
+
+void DisparityConverter::toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::deque<DisparityMsgs::DisparityImage>& outDispImageMsgs) {
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         tstamp = inData->getTimestampDevice();
     else
         tstamp = inData->getTimestamp();
 
-    DisparityMsgs::DisparityImage outDispImageMsg;
+    // Built in place, so the converted image is never copied.
+    outDispImageMsgs.emplace_back();
+    DisparityMsgs::DisparityImage& outDispImageMsg = outDispImageMsgs.back();
     outDispImageMsg.header.frame_id = _frameName;
     outDispImageMsg.f = _focalLength;
     outDispImageMsg.min_disparity = _focalLength * _baseline / _maxDepth;
@@ -43,63 +53,37 @@ void DisparityConverter::toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::de
 
     outDispImageMsg.t = _baseline / 100.0;  // converting cm to meters
 
-    // copying the data to ros msg
-    // outDispImageMsg.header       = imgHeader;
-    // std::string temp_str(encodingEnumMap[inData->getType()]);
     ImageMsgs::Image& outImageMsg = outDispImageMsg.image;
-    outDispImageMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    outDispImageMsg.header.stamp = _clockSync->toRosTime(tstamp);
 
     outImageMsg.encoding = sensor_msgs::image_encodings::TYPE_32FC1;
     outImageMsg.header = outDispImageMsg.header;
+    outImageMsg.height = inData->getHeight();
+    outImageMsg.width = inData->getWidth();
+    outImageMsg.step = inData->getWidth() * sizeof(float);
+    outImageMsg.is_bigendian = true;
+    size_t numPixels = static_cast<size_t>(inData->getHeight()) * inData->getWidth();
+    outImageMsg.data.resize(numPixels * sizeof(float));
+    float* outData = reinterpret_cast<float*>(outImageMsg.data.data());
+
+    // Single pass from the frame buffer into the message, with the SIMD kernels selected for this host.
     if(inData->getType() == dai::RawImgFrame::Type::RAW8) {
         outDispImageMsg.delta_d = 1.0;
-        size_t size = inData->getData().size() * sizeof(float);
-        outImageMsg.data.resize(size);
-        outImageMsg.height = inData->getHeight();
-        outImageMsg.width = inData->getWidth();
-        outImageMsg.step = size / inData->getHeight();
-        outImageMsg.is_bigendian = true;
-
-        std::vector<float> convertedData(inData->getData().begin(), inData->getData().end());
-        unsigned char* imageMsgDataPtr = reinterpret_cast<unsigned char*>(outImageMsg.data.data());
-
-        unsigned char* daiImgData = reinterpret_cast<unsigned char*>(convertedData.data());
-
-        // TODO(Sachin): Try using assign since it is a vector
-        // img->data.assign(packet.data->cbegin(), packet.data->cend());
-        memcpy(imageMsgDataPtr, daiImgData, size);
-
+        numPixels = std::min(numPixels, inData->getData().size());
+        disparityToFloat(inData->getData().data(), outData, numPixels);
     } else {
-        outDispImageMsg.delta_d = 1.0 / 32.0;
-        size_t size = inData->getHeight() * inData->getWidth() * sizeof(float);
-        outImageMsg.data.resize(size);
-        outImageMsg.height = inData->getHeight();
-        outImageMsg.width = inData->getWidth();
-        outImageMsg.step = size / inData->getHeight();
-        outImageMsg.is_bigendian = true;
-        unsigned char* daiImgData = reinterpret_cast<unsigned char*>(inData->getData().data());
-
-        std::vector<int16_t> raw16Data(inData->getHeight() * inData->getWidth());
-        unsigned char* raw16DataPtr = reinterpret_cast<unsigned char*>(raw16Data.data());
-        memcpy(raw16DataPtr, daiImgData, inData->getData().size());
-        std::vector<float> convertedData;
-        std::transform(
-            raw16Data.begin(), raw16Data.end(), std::back_inserter(convertedData), [](int16_t disp) -> std::size_t { return static_cast<float>(disp) / 32.0; });
-
-        unsigned char* imageMsgDataPtr = reinterpret_cast<unsigned char*>(outImageMsg.data.data());
-        unsigned char* convertedDataPtr = reinterpret_cast<unsigned char*>(convertedData.data());
-        memcpy(imageMsgDataPtr, convertedDataPtr, size);
+        outDispImageMsg.delta_d = 1.0 / static_cast<double>(1 << _subpixelFractionalBits);
+        const int16_t* inDisp = reinterpret_cast<const int16_t*>(inData->getData().data());
+        numPixels = std::min(numPixels, inData->getData().size() / sizeof(int16_t));
+        subpixelDisparityToFloat(inDisp, outData, numPixels, static_cast<float>(outDispImageMsg.delta_d));
     }
-    outDispImageMsgs.push_back(outDispImageMsg);
     return;
 }
 
 DisparityImagePtr DisparityConverter::toRosMsgPtr(std::shared_ptr<dai::ImgFrame> inData) {
     std::deque<DisparityMsgs::DisparityImage> msgQueue;
     toRosMsg(inData, msgQueue);
-    auto msg = msgQueue.front();
-
-    DisparityImagePtr ptr = std::make_shared<DisparityMsgs::DisparityImage>(msg);
+    DisparityImagePtr ptr = std::make_shared<DisparityMsgs::DisparityImage>(std::move(msgQueue.front()));
 
     return ptr;
 }
@@ -0,0 +1,156 @@
+#include "depthai_bridge/DisparityKernels.hpp"
+
+#include <cstring>
+
+#if(defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define DEPTHAI_BRIDGE_X86_KERNELS
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+    #define DEPTHAI_BRIDGE_NEON_KERNELS
+    #include <arm_neon.h>
+#endif
+
+namespace dai {
+
+namespace ros {
+
+namespace {
+
+void toFloatScalar(const uint8_t* src, float* dst, size_t numPixels) {
+    for(size_t i = 0; i < numPixels; i++) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+void subpixelToFloatScalar(const int16_t* src, float* dst, size_t numPixels, float scale) {
+    for(size_t i = 0; i < numPixels; i++) {
+        // RAW16 payloads live in a byte vector, so the values are not necessarily 2 byte aligned.
+        int16_t disp;
+        std::memcpy(&disp, src + i, sizeof(disp));
+        dst[i] = static_cast<float>(disp) * scale;
+    }
+}
+
+#ifdef DEPTHAI_BRIDGE_X86_KERNELS
+
+__attribute__((target("sse4.1"))) void toFloatSSE41(const uint8_t* src, float* dst, size_t numPixels) {
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        for(int quarter = 0; quarter < 4; quarter++) {
+            // pmovzxbd widens the lowest 4 bytes, the shift brings the next 4 down.
+            __m128i widened = _mm_cvtepu8_epi32(in);
+            _mm_storeu_ps(dst + i + quarter * 4, _mm_cvtepi32_ps(widened));
+            in = _mm_srli_si128(in, 4);
+        }
+    }
+    toFloatScalar(src + i, dst + i, numPixels - i);
+}
+
+__attribute__((target("sse4.1"))) void subpixelToFloatSSE41(const int16_t* src, float* dst, size_t numPixels, float scale) {
+    const __m128 vScale = _mm_set1_ps(scale);
+    size_t i = 0;
+    for(; i + 8 <= numPixels; i += 8) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128 lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(in));
+        __m128 hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(in, 8)));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(lo, vScale));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(hi, vScale));
+    }
+    subpixelToFloatScalar(src + i, dst + i, numPixels - i, scale);
+}
+
+__attribute__((target("avx2"))) void toFloatAVX2(const uint8_t* src, float* dst, size_t numPixels) {
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m256i lo = _mm256_cvtepu8_epi32(in);
+        __m256i hi = _mm256_cvtepu8_epi32(_mm_srli_si128(in, 8));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(lo));
+        _mm256_storeu_ps(dst + i + 8, _mm256_cvtepi32_ps(hi));
+    }
+    toFloatSSE41(src + i, dst + i, numPixels - i);
+}
+
+__attribute__((target("avx2"))) void subpixelToFloatAVX2(const int16_t* src, float* dst, size_t numPixels, float scale) {
+    const __m256 vScale = _mm256_set1_ps(scale);
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        __m128i inLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i inHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(inLo));
+        __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(inHi));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(lo, vScale));
+        _mm256_storeu_ps(dst + i + 8, _mm256_mul_ps(hi, vScale));
+    }
+    subpixelToFloatSSE41(src + i, dst + i, numPixels - i, scale);
+}
+
+#endif
+
+#ifdef DEPTHAI_BRIDGE_NEON_KERNELS
+
+void toFloatNEON(const uint8_t* src, float* dst, size_t numPixels) {
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        uint8x16_t in = vld1q_u8(src + i);
+        uint16x8_t lo = vmovl_u8(vget_low_u8(in));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(in));
+        vst1q_f32(dst + i, vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))));
+        vst1q_f32(dst + i + 8, vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))));
+        vst1q_f32(dst + i + 12, vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))));
+    }
+    toFloatScalar(src + i, dst + i, numPixels - i);
+}
+
+void subpixelToFloatNEON(const int16_t* src, float* dst, size_t numPixels, float scale) {
+    size_t i = 0;
+    for(; i + 8 <= numPixels; i += 8) {
+        // Loaded as bytes, vld1q_s16 may assume 2 byte alignment.
+        int16x8_t in = vreinterpretq_s16_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(src + i)));
+        vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), scale));
+        vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), scale));
+    }
+    subpixelToFloatScalar(src + i, dst + i, numPixels - i, scale);
+}
+
+#endif
+
+const DisparityKernelSet& kernels() {
+    static const DisparityKernelSet selected = supportedDisparityKernels().back();
+    return selected;
+}
+
+}  // namespace
+
+void disparityToFloat(const uint8_t* src, float* dst, size_t numPixels) {
+    kernels().toFloat(src, dst, numPixels);
+}
+
+void subpixelDisparityToFloat(const int16_t* src, float* dst, size_t numPixels, float scale) {
+    kernels().subpixelToFloat(src, dst, numPixels, scale);
+}
+
+const char* disparityKernelName() {
+    return kernels().name;
+}
+
+std::vector<DisparityKernelSet> supportedDisparityKernels() {
+    std::vector<DisparityKernelSet> sets = {{"scalar", toFloatScalar, subpixelToFloatScalar}};
+#if defined(DEPTHAI_BRIDGE_X86_KERNELS)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse4.1")) {
+        sets.push_back({"sse4.1", toFloatSSE41, subpixelToFloatSSE41});
+        if(__builtin_cpu_supports("avx2")) {
+            sets.push_back({"avx2", toFloatAVX2, subpixelToFloatAVX2});
+        }
+    }
+#elif defined(DEPTHAI_BRIDGE_NEON_KERNELS)
+    sets.push_back({"neon", toFloatNEON, subpixelToFloatNEON});
+#endif
+    return sets;
+}
+
+}  // namespace ros
+}  // namespace dai
@@ -1,6 +1,8 @@
-
 #include "depthai_bridge/ImageConverter.hpp"
 
+#include <algorithm>
+
+#include "depthai_bridge/PlanarKernels.hpp"
 #include "depthai_bridge/depthaiUtility.hpp"
 #include "opencv2/calib3d.hpp"
 #include "opencv2/imgcodecs.hpp"
@@ -16,7 +18,8 @@ std::unordered_map<dai::RawImgFrame::Type, std::string> ImageConverter::encoding
                                                                                            {dai::RawImgFrame::Type::GRAY8, "mono8"},
                                                                                            {dai::RawImgFrame::Type::RAW8, "mono8"},
                                                                                            {dai::RawImgFrame::Type::RAW16, "16UC1"},
-                                                                                           {dai::RawImgFrame::Type::YUV420p, "YUV420"}};
+                                                                                           {dai::RawImgFrame::Type::YUV420p, YUV420_ENCODING},
+                                                                                           {dai::RawImgFrame::Type::NV12, NV12_ENCODING}};
 // TODO(sachin) : Move Planare to encodingEnumMap and use default planar namings. And convertt those that are not supported in ROS using ImageTransport in the
 // bridge.
 std::unordered_map<dai::RawImgFrame::Type, std::string> ImageConverter::planarEncodingEnumMap = {
@@ -26,24 +29,37 @@ std::unordered_map<dai::RawImgFrame::Type, std::string> ImageConverter::planarEn
     {dai::RawImgFrame::Type::YUV420p, "rgb8"}};
 
 ImageConverter::ImageConverter(bool interleaved, bool getBaseDeviceTimestamp)
-    : _daiInterleaved(interleaved), _steadyBaseTime(std::chrono::steady_clock::now()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+    : _daiInterleaved(interleaved), _clockSync(std::make_shared<ClockSync>()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 ImageConverter::ImageConverter(const std::string frameName, bool interleaved, bool getBaseDeviceTimestamp)
-    : _frameName(frameName), _daiInterleaved(interleaved), _steadyBaseTime(std::chrono::steady_clock::now()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+    : _frameName(frameName), _daiInterleaved(interleaved), _clockSync(std::make_shared<ClockSync>()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 ImageConverter::~ImageConverter() = default;
 
 void ImageConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void ImageConverter::convertFromBitstream(dai::RawImgFrame::Type srcType) {
+    convertFromBitstream(srcType, dai::VideoEncoderProperties::Profile::MJPEG);
+}
+
+void ImageConverter::convertFromBitstream(dai::RawImgFrame::Type srcType, dai::VideoEncoderProperties::Profile profile) {
     _fromBitstream = true;
     _srcType = srcType;
+    _bitstreamProfile = profile;
+    if(isVideoBitstream()) {
+        _videoDecoder.setCodec(profile == dai::VideoEncoderProperties::Profile::H265_MAIN ? VideoDecoder::Codec::H265 : VideoDecoder::Codec::H264);
+    }
+}
+
+bool ImageConverter::isVideoBitstream() const {
+    return _fromBitstream && _bitstreamProfile != dai::VideoEncoderProperties::Profile::MJPEG;
+}
+
+void ImageConverter::setDecodeScale(int scale) {
+    _jpegDecoder.setScale(scale);
+    _videoDecoder.setScale(scale);
 }
 
 void ImageConverter::convertDispToDepth(double baseline) {
@@ -51,6 +67,22 @@ void ImageConverter::convertDispToDepth(double baseline) {
     _baseline = baseline;
 }
 
+const std::vector<uint16_t>& ImageConverter::getDispToDepthLUT(double focalLength) {
+    if(!_dispToDepthLUT.empty() && focalLength == _lutFocalLength && _baseline == _lutBaseline) {
+        return _dispToDepthLUT;
+    }
+    // depth [mm] = baseline [mm] * focal [px] / disparity [px], truncated like the per pixel conversion it replaces.
+    const double factor = std::abs(_baseline * 10) * focalLength;
+    _dispToDepthLUT.resize(256);
+    _dispToDepthLUT[0] = 0;
+    for(size_t disp = 1; disp < _dispToDepthLUT.size(); disp++) {
+        _dispToDepthLUT[disp] = static_cast<uint16_t>(std::min(factor / disp, 65535.0));
+    }
+    _lutFocalLength = focalLength;
+    _lutBaseline = _baseline;
+    return _dispToDepthLUT;
+}
+
 void ImageConverter::addExposureOffset(dai::CameraExposureOffset& offset) {
     _expOffset = offset;
     _addExpOffset = true;
@@ -60,15 +92,42 @@ void ImageConverter::reverseStereoSocketOrder() {
     _reverseStereoSocketOrder = true;
 }
 
+bool ImageConverter::isStereoSocketOrderReversed() const {
+    return _reverseStereoSocketOrder;
+}
+
 void ImageConverter::setAlphaScaling(double alphaScalingFactor) {
     _alphaScalingEnabled = true;
     _alphaScalingFactor = alphaScalingFactor;
 }
 
+bool ImageConverter::isAlphaScalingEnabled() const {
+    return _alphaScalingEnabled;
+}
+
+double ImageConverter::getAlphaScalingFactor() const {
+    return _alphaScalingFactor;
+}
+
+void ImageConverter::setNativeYUV(bool nativeYUV) {
+    _nativeYUV = nativeYUV;
+}
+
 ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> inData, const sensor_msgs::msg::CameraInfo& info) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
+    ImageMsgs::Image outImageMsg;
+    fillRosMsg(inData, info, outImageMsg);
+    return outImageMsg;
+}
+
+ImageMsgs::Image::UniquePtr ImageConverter::toRosMsgUniquePtr(std::shared_ptr<dai::ImgFrame> inData, const sensor_msgs::msg::CameraInfo& info) {
+    auto outImageMsg = std::make_unique<ImageMsgs::Image>();
+    if(!fillRosMsg(inData, info, *outImageMsg)) {
+        return nullptr;
     }
+    return outImageMsg;
+}
+
+StdMsgs::Header ImageConverter::getFrameHeader(std::shared_ptr<dai::ImgFrame> inData) {
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         if(_addExpOffset)
@@ -79,34 +138,79 @@ ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> i
         tstamp = inData->getTimestamp(_expOffset);
     else
         tstamp = inData->getTimestamp();
-    ImageMsgs::Image outImageMsg;
     StdMsgs::Header header;
     header.frame_id = _frameName;
 
-    header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    header.stamp = _clockSync->toRosTime(tstamp);
+    return header;
+}
+
+ImageMsgs::CompressedImage::UniquePtr ImageConverter::toRosCompressedMsg(std::shared_ptr<dai::ImgFrame> inData) {
+    if(!_fromBitstream) {
+        throw(std::runtime_error("Compressed passthrough requires bitstream input!"));
+    }
+    auto outMsg = std::make_unique<ImageMsgs::CompressedImage>();
+    outMsg->header = getFrameHeader(inData);
+    if(isVideoBitstream()) {
+        throw(std::runtime_error("Compressed passthrough requires MJPEG bitstream, use toRosFFMPEGPacket for H.264/H.265!"));
+    }
+    // Same format strings as the compressed image_transport plugin, so its subscribers can decode the stream.
+    switch(_srcType) {
+        case dai::RawImgFrame::Type::BGR888i:
+            outMsg->format = "bgr8; jpeg compressed bgr8";
+            break;
+        case dai::RawImgFrame::Type::GRAY8:
+        case dai::RawImgFrame::Type::RAW8:
+            outMsg->format = "mono8; jpeg compressed mono8";
+            break;
+        default:
+            throw(std::runtime_error("Converted type not supported!"));
+    }
+    outMsg->data = std::move(inData->getData());
+    return outMsg;
+}
+
+depthai_ros_msgs::msg::FFMPEGPacket::UniquePtr ImageConverter::toRosFFMPEGPacket(std::shared_ptr<dai::ImgFrame> inData) {
+    if(!isVideoBitstream()) {
+        throw(std::runtime_error("FFMPEG packets require H.264/H.265 bitstream input!"));
+    }
+    auto outMsg = std::make_unique<depthai_ros_msgs::msg::FFMPEGPacket>();
+    outMsg->header = getFrameHeader(inData);
+    outMsg->width = inData->getWidth();
+    outMsg->height = inData->getHeight();
+    outMsg->encoding = _videoDecoder.getCodec() == VideoDecoder::Codec::H265 ? "hevc" : "h264";
+    outMsg->pts = inData->getSequenceNum();
+    outMsg->flags = VideoDecoder::isKeyframe(inData->getData().data(), inData->getData().size(), _videoDecoder.getCodec()) ? 1 : 0;
+    outMsg->is_bigendian = false;
+    outMsg->data = std::move(inData->getData());
+    return outMsg;
+}
+
+bool ImageConverter::fillRosMsg(std::shared_ptr<dai::ImgFrame> inData, const sensor_msgs::msg::CameraInfo& info, ImageMsgs::Image& outImageMsg) {
+    StdMsgs::Header header = getFrameHeader(inData);
 
     if(_fromBitstream) {
         std::string encoding;
         int decodeFlags;
-        int channels;
-        cv::Mat output;
+        int cvType;
         switch(_srcType) {
             case dai::RawImgFrame::Type::BGR888i: {
                 encoding = sensor_msgs::image_encodings::BGR8;
                 decodeFlags = cv::IMREAD_COLOR;
-                channels = CV_8UC3;
+                cvType = CV_8UC3;
                 break;
             }
             case dai::RawImgFrame::Type::GRAY8: {
                 encoding = sensor_msgs::image_encodings::MONO8;
                 decodeFlags = cv::IMREAD_GRAYSCALE;
-                channels = CV_8UC1;
+                cvType = CV_8UC1;
                 break;
             }
             case dai::RawImgFrame::Type::RAW8: {
-                encoding = sensor_msgs::image_encodings::TYPE_16UC1;
+                // Encoded disparity is 8 bit, it only becomes 16UC1 once converted to depth.
+                encoding = sensor_msgs::image_encodings::MONO8;
                 decodeFlags = cv::IMREAD_ANYDEPTH;
-                channels = CV_16UC1;
+                cvType = CV_8UC1;
                 break;
             }
             default: {
@@ -115,27 +219,74 @@ ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> i
             }
         }
 
-        output = cv::imdecode(cv::Mat(inData->getData()), decodeFlags);
+        if(isVideoBitstream()) {
+            if(_convertDispToDepth) {
+                throw(std::runtime_error("Disparity to depth conversion requires MJPEG bitstream!"));
+            }
+            // Every packet references the previous ones, a gap means the decoder has to start over from a keyframe.
+            int64_t sequenceNum = inData->getSequenceNum();
+            if(_lastVideoSequenceNum >= 0 && sequenceNum != _lastVideoSequenceNum + 1) {
+                _videoDecoder.reset();
+            }
+            _lastVideoSequenceNum = sequenceNum;
+            int width, height;
+            if(!_videoDecoder.decodeInto(inData->getData(), cvType, outImageMsg.data, width, height)) {
+                return false;
+            }
+            outImageMsg.header = header;
+            outImageMsg.encoding = encoding;
+            outImageMsg.width = width;
+            outImageMsg.height = height;
+            outImageMsg.step = outImageMsg.data.size() / height;
+            outImageMsg.is_bigendian = false;
+            return true;
+        }
 
         // converting disparity
         if(_convertDispToDepth) {
-            auto factor = std::abs(_baseline * 10) * info.p[0];
-            cv::Mat depthOut = cv::Mat(cv::Size(output.cols, output.rows), CV_16UC1);
-            depthOut.forEach<uint16_t>([&output, &factor](uint16_t& pixel, const int* position) -> void {
-                auto disp = output.at<uint8_t>(position);
-                if(disp == 0)
-                    pixel = 0;
-                else
-                    pixel = factor / disp;
-            });
-            output = depthOut.clone();
+            const cv::Mat& output = _jpegDecoder.decode(inData->getData(), decodeFlags);
+            // The encoder only takes 8 bit disparity, subpixel frames never reach this path.
+            if(output.depth() != CV_8U) {
+                throw(std::runtime_error("Disparity bit depth not supported!"));
+            }
+            // Decoding at reduced scale shrinks the image but not the disparity values, so use the full resolution focal length.
+            const auto& lut = getDispToDepthLUT(info.p[0] * _jpegDecoder.getScale());
+            outImageMsg.header = header;
+            outImageMsg.encoding = sensor_msgs::image_encodings::TYPE_16UC1;
+            outImageMsg.height = output.rows;
+            outImageMsg.width = output.cols;
+            outImageMsg.step = output.cols * sizeof(uint16_t);
+            outImageMsg.is_bigendian = false;
+            outImageMsg.data.resize(outImageMsg.step * outImageMsg.height);
+            for(int row = 0; row < output.rows; row++) {
+                const auto* dispRow = output.ptr<uint8_t>(row);
+                auto* depthRow = reinterpret_cast<uint16_t*>(outImageMsg.data.data() + row * outImageMsg.step);
+                for(int col = 0; col < output.cols; col++) depthRow[col] = lut[dispRow[col]];
+            }
+            return true;
         }
-        cv_bridge::CvImage(header, encoding, output).toImageMsg(outImageMsg);
-        return outImageMsg;
+        int width, height;
+        _jpegDecoder.decodeInto(inData->getData(), decodeFlags, cvType, outImageMsg.data, width, height);
+        outImageMsg.header = header;
+        outImageMsg.encoding = encoding;
+        outImageMsg.width = width;
+        outImageMsg.height = height;
+        outImageMsg.step = outImageMsg.data.size() / height;
+        outImageMsg.is_bigendian = false;
+        return true;
     }
 
-    if(planarEncodingEnumMap.find(inData->getType()) != planarEncodingEnumMap.end()) {
-        // cv::Mat inImg = inData->getCvFrame();
+    if(_nativeYUV && (inData->getType() == dai::RawImgFrame::Type::NV12 || inData->getType() == dai::RawImgFrame::Type::YUV420p)) {
+        // Hand over the device buffer as is, it is half the size of the bgr8 conversion. Chroma rows follow the luma rows.
+        outImageMsg.header = header;
+        outImageMsg.encoding = encodingEnumMap[inData->getType()];
+        outImageMsg.height = inData->getHeight() * 3 / 2;
+        outImageMsg.width = inData->getWidth();
+        outImageMsg.step = inData->getWidth();
+        outImageMsg.is_bigendian = false;
+        outImageMsg.data = std::move(inData->getData());
+    } else if(planarEncodingEnumMap.find(inData->getType()) != planarEncodingEnumMap.end()) {
+        // Conversion results are written straight into the message buffer instead of going through cv_bridge.
         cv::Mat mat, output;
         cv::Size size = {0, 0};
         int type = 0;
@@ -157,23 +308,26 @@ ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> i
         }
         mat = cv::Mat(size, type, inData->getData().data());
 
+        outImageMsg.header = header;
+        outImageMsg.encoding = sensor_msgs::image_encodings::BGR8;
+        outImageMsg.height = inData->getHeight();
+        outImageMsg.width = inData->getWidth();
+        outImageMsg.step = outImageMsg.width * 3;
+        outImageMsg.is_bigendian = false;
+        outImageMsg.data.resize(outImageMsg.step * outImageMsg.height);
+        output = cv::Mat(outImageMsg.height, outImageMsg.width, CV_8UC3, outImageMsg.data.data(), outImageMsg.step);
+
         switch(inData->getType()) {
             case dai::RawImgFrame::Type::RGB888p: {
-                cv::Size s(inData->getWidth(), inData->getHeight());
-                cv::Mat m1 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 2);
-                cv::Mat m2 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 1);
-                cv::Mat m3 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 0);
-                cv::Mat channels[3] = {m1, m2, m3};
-                cv::merge(channels, 3, output);
+                size_t area = outImageMsg.width * outImageMsg.height;
+                const uint8_t* planes = inData->getData().data();
+                interleavePlanes(planes + area * 2, planes + area * 1, planes + area * 0, outImageMsg.data.data(), area);
             } break;
 
             case dai::RawImgFrame::Type::BGR888p: {
-                cv::Size s(inData->getWidth(), inData->getHeight());
-                cv::Mat m1 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 0);
-                cv::Mat m2 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 1);
-                cv::Mat m3 = cv::Mat(s, CV_8UC1, inData->getData().data() + s.area() * 2);
-                cv::Mat channels[3] = {m1, m2, m3};
-                cv::merge(channels, 3, output);
+                size_t area = outImageMsg.width * outImageMsg.height;
+                const uint8_t* planes = inData->getData().data();
+                interleavePlanes(planes + area * 0, planes + area * 1, planes + area * 2, outImageMsg.data.data(), area);
             } break;
 
             case dai::RawImgFrame::Type::YUV420p:
@@ -185,13 +339,12 @@ ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> i
                 break;
 
             default:
-                output = mat.clone();
+                mat.copyTo(output);
                 break;
         }
-        cv_bridge::CvImage(header, sensor_msgs::image_encodings::BGR8, output).toImageMsg(outImageMsg);
 
     } else if(encodingEnumMap.find(inData->getType()) != encodingEnumMap.end()) {
-        // copying the data to ros msg
+        // Interleaved payload is already in ROS layout, hand over the buffer instead of copying it.
         outImageMsg.header = header;
         std::string temp_str(encodingEnumMap[inData->getType()]);
         outImageMsg.encoding = temp_str;
@@ -203,30 +356,33 @@ ImageMsgs::Image ImageConverter::toRosMsgRawPtr(std::shared_ptr<dai::ImgFrame> i
         else
             outImageMsg.is_bigendian = true;
 
-        size_t size = inData->getData().size();
-        outImageMsg.data.reserve(size);
         outImageMsg.data = std::move(inData->getData());
     }
-    return outImageMsg;
+    return true;
 }
 
 void ImageConverter::toRosMsg(std::shared_ptr<dai::ImgFrame> inData, std::deque<ImageMsgs::Image>& outImageMsgs) {
-    auto outImageMsg = toRosMsgRawPtr(inData);
-    outImageMsgs.push_back(outImageMsg);
+    ImageMsgs::Image outImageMsg;
+    if(fillRosMsg(inData, sensor_msgs::msg::CameraInfo(), outImageMsg)) {
+        outImageMsgs.emplace_back(std::move(outImageMsg));
+    }
     return;
 }
 
 ImagePtr ImageConverter::toRosMsgPtr(std::shared_ptr<dai::ImgFrame> inData) {
-    auto msg = toRosMsgRawPtr(inData);
-
-    ImagePtr ptr = std::make_shared<ImageMsgs::Image>(msg);
+    ImagePtr ptr = std::make_shared<ImageMsgs::Image>();
+    if(!fillRosMsg(inData, sensor_msgs::msg::CameraInfo(), *ptr)) {
+        return nullptr;
+    }
     return ptr;
 }
 
 void ImageConverter::toDaiMsg(const ImageMsgs::Image& inMsg, dai::ImgFrame& outData) {
-    std::unordered_map<dai::RawImgFrame::Type, std::string>::iterator revEncodingIter;
-    if(_daiInterleaved) {
-        revEncodingIter = std::find_if(encodingEnumMap.begin(), encodingEnumMap.end(), [&](const std::pair<dai::RawImgFrame::Type, std::string>& pair) {
+    dai::RawImgFrame::Type daiType;
+    // Only 3 channel 8 bit images have a planar DAI counterpart, everything else is passed on as is.
+    bool toPlanar = !_daiInterleaved && (inMsg.encoding == sensor_msgs::image_encodings::BGR8 || inMsg.encoding == sensor_msgs::image_encodings::RGB8);
+    if(!toPlanar) {
+        auto revEncodingIter = std::find_if(encodingEnumMap.begin(), encodingEnumMap.end(), [&](const std::pair<dai::RawImgFrame::Type, std::string>& pair) {
             return pair.second == inMsg.encoding;
         });
         if(revEncodingIter == encodingEnumMap.end())
@@ -234,21 +390,14 @@ void ImageConverter::toDaiMsg(const ImageMsgs::Image& inMsg, dai::ImgFrame& outD
                 "Unable to find DAI encoding for the corresponding "
                 "sensor_msgs::image.encoding stream");
 
+        daiType = revEncodingIter->first;
         outData.setData(inMsg.data);
     } else {
-        revEncodingIter = std::find_if(encodingEnumMap.begin(), encodingEnumMap.end(), [&](const std::pair<dai::RawImgFrame::Type, std::string>& pair) {
-            return pair.second.find(inMsg.encoding) != std::string::npos;
-        });
-
-        std::istringstream f(revEncodingIter->second);
-        std::vector<std::string> encoding_info;
-        std::string s;
-
-        while(getline(f, s, '_')) encoding_info.push_back(s);
-
+        // Planes keep the channel order of the encoding.
+        daiType = inMsg.encoding == sensor_msgs::image_encodings::BGR8 ? dai::RawImgFrame::Type::BGR888p : dai::RawImgFrame::Type::RGB888p;
         std::vector<std::uint8_t> opData(inMsg.data.size());
-        interleavedToPlanar(inMsg.data, opData, inMsg.height, inMsg.width, std::stoi(encoding_info[0]), std::stoi(encoding_info[1]));
-        outData.setData(opData);
+        interleavedToPlanar(inMsg.data, opData, inMsg.width, inMsg.height, 3, 1);
+        outData.setData(std::move(opData));
     }
 
     /** FIXME(sachin) : is this time convertion correct ???
@@ -266,24 +415,13 @@ void ImageConverter::toDaiMsg(const ImageMsgs::Image& inMsg, dai::ImgFrame& outD
       outData.setSequenceNum(inMsg.header.seq); */
     outData.setWidth(inMsg.width);
     outData.setHeight(inMsg.height);
-    outData.setType(revEncodingIter->first);
+    outData.setType(daiType);
 }
 
 void ImageConverter::planarToInterleaved(const std::vector<uint8_t>& srcData, std::vector<uint8_t>& destData, int w, int h, int numPlanes, int bpp) {
-    if(numPlanes == 3) {
-        // optimization (cache)
-        for(int i = 0; i < w * h; i++) {
-            uint8_t b = srcData.data()[i + w * h * 0];
-            destData[i * 3 + 0] = b;
-        }
-        for(int i = 0; i < w * h; i++) {
-            uint8_t g = srcData.data()[i + w * h * 1];
-            destData[i * 3 + 1] = g;
-        }
-        for(int i = 0; i < w * h; i++) {
-            uint8_t r = srcData.data()[i + w * h * 2];
-            destData[i * 3 + 2] = r;
-        }
+    if(numPlanes == 3 && bpp == 1) {
+        size_t area = static_cast<size_t>(w) * h;
+        interleavePlanes(srcData.data() + area * 0, srcData.data() + area * 1, srcData.data() + area * 2, destData.data(), area);
     } else {
         throw std::runtime_error(
             "If you encounter the scenario where you need this "
@@ -293,25 +431,9 @@ void ImageConverter::planarToInterleaved(const std::vector<uint8_t>& srcData, st
 }
 
 void ImageConverter::interleavedToPlanar(const std::vector<uint8_t>& srcData, std::vector<uint8_t>& destData, int w, int h, int numPlanes, int bpp) {
-    if(numPlanes == 3) {
-        // optimization (cache)
-        for(int i = 0; i < w * h; i++) {
-            uint8_t b = srcData[i * 3 + 0];
-            uint8_t g = srcData[i * 3 + 1];
-            uint8_t r = srcData[i * 3 + 2];
-
-            destData[i + w * h * 0] = b;
-            destData[i + w * h * 1] = g;
-            destData[i + w * h * 2] = r;
-        }
-        // for(int i = 0; i < w*h; i++) {
-        //     uint8_t g = srcData.data()[i + w*h * 1];
-        //     destData[i*3+1] = g;
-        // }
-        // for(int i = 0; i < w*h; i++) {
-        //     uint8_t r = srcData.data()[i + w*h * 2];
-        //     destData[i*3+2] = r;
-        // }
+    if(numPlanes == 3 && bpp == 1) {
+        size_t area = static_cast<size_t>(w) * h;
+        deinterleavePlanes(srcData.data(), destData.data() + area * 0, destData.data() + area * 1, destData.data() + area * 2, area);
     } else {
         throw std::runtime_error(
             "If you encounter the scenario where you need this "
@@ -321,15 +443,27 @@ void ImageConverter::interleavedToPlanar(const std::vector<uint8_t>& srcData, st
 }
 
 cv::Mat ImageConverter::rosMsgtoCvMat(ImageMsgs::Image& inMsg) {
-    cv::Mat rgb(inMsg.height, inMsg.width, CV_8UC3);
-    if(inMsg.encoding == "nv12") {
-        cv::Mat nv_frame(inMsg.height * 3 / 2, inMsg.width, CV_8UC1, inMsg.data.data());
-        cv::cvtColor(nv_frame, rgb, cv::COLOR_YUV2BGR_NV12);
-        return rgb;
+    if(inMsg.encoding == sensor_msgs::image_encodings::BGR8) {
+        return cv::Mat(inMsg.height, inMsg.width, CV_8UC3, inMsg.data.data(), inMsg.step);
+    }
+    if(inMsg.encoding == sensor_msgs::image_encodings::MONO8) {
+        return cv::Mat(inMsg.height, inMsg.width, CV_8UC1, inMsg.data.data(), inMsg.step);
+    }
+    cv::Mat bgr;
+    if(inMsg.encoding == sensor_msgs::image_encodings::RGB8) {
+        cv::cvtColor(cv::Mat(inMsg.height, inMsg.width, CV_8UC3, inMsg.data.data(), inMsg.step), bgr, cv::COLOR_RGB2BGR);
+    } else if(inMsg.encoding == NV12_ENCODING) {
+        // Message rows cover luma and chroma, cvtColor reads the same layout and outputs the image at 2/3 of the message height.
+        cv::cvtColor(cv::Mat(inMsg.height, inMsg.width, CV_8UC1, inMsg.data.data(), inMsg.step), bgr, cv::COLOR_YUV2BGR_NV12);
+    } else if(inMsg.encoding == YUV420_ENCODING) {
+        cv::cvtColor(cv::Mat(inMsg.height, inMsg.width, CV_8UC1, inMsg.data.data(), inMsg.step), bgr, cv::COLOR_YUV2BGR_IYUV);
+    } else if(inMsg.encoding == sensor_msgs::image_encodings::YUV422) {
+        cv::Mat yuv(inMsg.height, inMsg.width, CV_8UC2, inMsg.data.data(), inMsg.step);
+        cv::cvtColor(yuv, bgr, cv::COLOR_YUV2BGR_UYVY);
     } else {
-        throw std::runtime_error("This frature is still WIP");
-        return rgb;
+        bgr = cv_bridge::toCvCopy(inMsg, sensor_msgs::image_encodings::BGR8)->image;
     }
+    return bgr;
 }
 ImageMsgs::CameraInfo ImageConverter::calibrationToCameraInfo(
     dai::CalibrationHandler calibHandler, dai::CameraBoardSocket cameraId, int width, int height, Point2f topLeftPixelId, Point2f bottomRightPixelId) {
@@ -11,30 +11,35 @@ ImgDetectionConverter::ImgDetectionConverter(std::string frameName, int width, i
       _width(width),
       _height(height),
       _normalized(normalized),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 ImgDetectionConverter::~ImgDetectionConverter() = default;
 
 void ImgDetectionConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void ImgDetectionConverter::toRosMsg(std::shared_ptr<dai::ImgDetections> inNetData, std::deque<VisionMsgs::Detection2DArray>& opDetectionMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
+    opDetectionMsgs.emplace_back();
+    fillMsg(inNetData, opDetectionMsgs.back());
+}
+
+void ImgDetectionConverter::toRosMsgInPlace(std::shared_ptr<dai::ImgDetections> inNetData, std::unique_ptr<VisionMsgs::Detection2DArray>& opDetectionMsg) {
+    if(!opDetectionMsg) {
+        opDetectionMsg = std::make_unique<VisionMsgs::Detection2DArray>();
     }
+    fillMsg(inNetData, *opDetectionMsg);
+}
+
+void ImgDetectionConverter::fillMsg(const std::shared_ptr<dai::ImgDetections>& inNetData, VisionMsgs::Detection2DArray& opDetectionMsg) {
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         tstamp = inNetData->getTimestampDevice();
     else
         tstamp = inNetData->getTimestamp();
 
-    VisionMsgs::Detection2DArray opDetectionMsg;
-
-    opDetectionMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    opDetectionMsg.header.stamp = _clockSync->toRosTime(tstamp);
     opDetectionMsg.header.frame_id = _frameName;
     opDetectionMsg.detections.resize(inNetData->detections.size());
 
@@ -79,18 +84,16 @@ void ImgDetectionConverter::toRosMsg(std::shared_ptr<dai::ImgDetections> inNetDa
         opDetectionMsg.detections[i].bbox.size_x = xSize;
         opDetectionMsg.detections[i].bbox.size_y = ySize;
     }
-
-    opDetectionMsgs.push_back(opDetectionMsg);
 }
 
 Detection2DArrayPtr ImgDetectionConverter::toRosMsgPtr(std::shared_ptr<dai::ImgDetections> inNetData) {
     std::deque<VisionMsgs::Detection2DArray> msgQueue;
     toRosMsg(inNetData, msgQueue);
-    auto msg = msgQueue.front();
+    auto msg = std::move(msgQueue.front());
 #ifdef IS_ROS2
-    Detection2DArrayPtr ptr = std::make_shared<VisionMsgs::Detection2DArray>(msg);
+    Detection2DArrayPtr ptr = std::make_shared<VisionMsgs::Detection2DArray>(std::move(msg));
 #else
-    Detection2DArrayPtr ptr = boost::make_shared<VisionMsgs::Detection2DArray>(msg);
+    Detection2DArrayPtr ptr = boost::make_shared<VisionMsgs::Detection2DArray>(std::move(msg));
 #endif
     return ptr;
 }
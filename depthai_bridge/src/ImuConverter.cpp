@@ -1,12 +1,22 @@
 
 #include "depthai_bridge/ImuConverter.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include "depthai_bridge/depthaiUtility.hpp"
+#include "tf2/LinearMath/Quaternion.h"
+#include "tf2/LinearMath/Vector3.h"
 
 namespace dai {
 
 namespace ros {
 
+// History capacity until setSensorRates is called, one second at the highest rate the IMUs support.
+static const size_t DEFAULT_HISTORY_CAPACITY{1000};
+// Lower bound so low rates still leave room for a few reports of the faster sensor.
+static const size_t MIN_HISTORY_CAPACITY{16};
+
 ImuConverter::ImuConverter(const std::string& frameName,
                            ImuSyncMethod syncMode,
                            double linear_accel_cov,
@@ -25,15 +35,116 @@ ImuConverter::ImuConverter(const std::string& frameName,
       _enable_rotation(enable_rotation),
       _enable_magn(enable_magn),
       _sequenceNum(0),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp),
+      _accelHist(DEFAULT_HISTORY_CAPACITY),
+      _gyroHist(DEFAULT_HISTORY_CAPACITY),
+      _rotationHist(DEFAULT_HISTORY_CAPACITY),
+      _magnHist(DEFAULT_HISTORY_CAPACITY),
+      _bundleSamples(DEFAULT_HISTORY_CAPACITY) {}
 
 ImuConverter::~ImuConverter() = default;
 
 void ImuConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
+}
+
+void ImuConverter::setSensorRates(int accelFreq, int gyroFreq, int rotationFreq, int magnFreq) {
+    // Rotation and magnetometer histories are padded to the length of the interpolated stream, so all share one capacity.
+    size_t capacity = std::max(MIN_HISTORY_CAPACITY, static_cast<size_t>(std::max({accelFreq, gyroFreq, rotationFreq, magnFreq, 0})));
+    _accelHist.setCapacity(capacity);
+    _gyroHist.setCapacity(capacity);
+    _rotationHist.setCapacity(capacity);
+    _magnHist.setCapacity(capacity);
+    std::lock_guard<std::mutex> lock(_bundleMutex);
+    _bundleSamples.setCapacity(capacity);
+}
+
+void ImuConverter::setFrameBundling(bool enable, bool preintegrate, std::chrono::milliseconds maxWait) {
+    std::lock_guard<std::mutex> lock(_bundleMutex);
+    _frameBundling = enable;
+    _preintegrate = preintegrate;
+    _bundleMaxWait = maxWait;
+    _bundleSamples.clear();
+    _lastBundleStampNs = 0;
+    _newestSampleNs = 0;
+}
+
+void ImuConverter::keepForBundle(const ImuMsgs::Imu& msg) {
+    {
+        std::lock_guard<std::mutex> lock(_bundleMutex);
+        _bundleSamples.push_back(msg);
+        _newestSampleNs = std::max(_newestSampleNs, rclcpp::Time(msg.header.stamp).nanoseconds());
+    }
+    _bundleCv.notify_all();
+}
+
+void ImuConverter::toRosFrameBundle(std::shared_ptr<dai::ImgFrame> inData, depthai_ros_msgs::msg::ImuFrameBundle& outBundle) {
+    std::chrono::_V2::steady_clock::time_point tstamp;
+    if(_getBaseDeviceTimestamp)
+        tstamp = inData->getTimestampDevice();
+    else
+        tstamp = inData->getTimestamp();
+    rclcpp::Time frameStamp = _clockSync->toRosTime(tstamp);
+    int64_t frameStampNs = frameStamp.nanoseconds();
+
+    outBundle.header.stamp = frameStamp;
+    outBundle.header.frame_id = _frameName;
+    outBundle.frame_sequence_num = inData->getSequenceNum();
+    outBundle.imu.clear();
+
+    std::unique_lock<std::mutex> lock(_bundleMutex);
+    if(!_bundleCv.wait_for(lock, _bundleMaxWait, [this, frameStampNs]() { return _newestSampleNs >= frameStampNs; })) {
+        DEPTHAI_ROS_DEBUG_STREAM("ImuConverter", "No IMU sample after frame " << inData->getSequenceNum() << " within the wait time, bundle may be short.");
+    }
+    while(!_bundleSamples.empty() && rclcpp::Time(_bundleSamples.front().header.stamp).nanoseconds() <= frameStampNs) {
+        outBundle.imu.push_back(std::move(_bundleSamples.front()));
+        _bundleSamples.pop_front();
+    }
+    outBundle.has_preintegration = _preintegrate && !outBundle.imu.empty();
+    if(outBundle.has_preintegration) {
+        // First bundle has no previous frame, it starts at its first sample.
+        int64_t startNs = _lastBundleStampNs > 0 ? _lastBundleStampNs : rclcpp::Time(outBundle.imu.front().header.stamp).nanoseconds();
+        preintegrate(outBundle, startNs, frameStampNs);
+    }
+    _lastBundleStampNs = frameStampNs;
+}
+
+void ImuConverter::preintegrate(depthai_ros_msgs::msg::ImuFrameBundle& bundle, int64_t startNs, int64_t endNs) {
+    tf2::Quaternion rotation(0.0, 0.0, 0.0, 1.0);
+    tf2::Vector3 velocity(0.0, 0.0, 0.0), position(0.0, 0.0, 0.0);
+    const auto& samples = bundle.imu;
+    for(size_t i = 0; i < samples.size(); i++) {
+        // Each sample holds until the next one, the first also covers the time since the previous frame. Segments are clipped to
+        // the interval, so a sample that arrived after the previous bundle only counts for the part of its segment in this one.
+        int64_t segmentStartNs = i == 0 ? startNs : std::max(startNs, rclcpp::Time(samples[i].header.stamp).nanoseconds());
+        int64_t segmentEndNs = i + 1 < samples.size() ? std::min(endNs, rclcpp::Time(samples[i + 1].header.stamp).nanoseconds()) : endNs;
+        double dt = static_cast<double>(segmentEndNs - segmentStartNs) * 1e-9;
+        if(dt <= 0.0) {
+            continue;
+        }
+        tf2::Vector3 accel(samples[i].linear_acceleration.x, samples[i].linear_acceleration.y, samples[i].linear_acceleration.z);
+        tf2::Vector3 gyro(samples[i].angular_velocity.x, samples[i].angular_velocity.y, samples[i].angular_velocity.z);
+        tf2::Vector3 rotatedAccel = tf2::quatRotate(rotation, accel);
+        position += velocity * dt + rotatedAccel * (0.5 * dt * dt);
+        velocity += rotatedAccel * dt;
+        double angle = gyro.length() * dt;
+        if(angle > 0.0) {
+            rotation = rotation * tf2::Quaternion(gyro.normalized(), angle);
+            rotation.normalize();
+        }
+    }
+    bundle.dt = static_cast<double>(endNs - startNs) * 1e-9;
+    bundle.delta_rotation.x = rotation.x();
+    bundle.delta_rotation.y = rotation.y();
+    bundle.delta_rotation.z = rotation.z();
+    bundle.delta_rotation.w = rotation.w();
+    bundle.delta_velocity.x = velocity.x();
+    bundle.delta_velocity.y = velocity.y();
+    bundle.delta_velocity.z = velocity.z();
+    bundle.delta_position.x = position.x();
+    bundle.delta_position.y = position.y();
+    bundle.delta_position.z = position.z();
 }
 
 void ImuConverter::fillImuMsg(ImuMsgs::Imu& msg, dai::IMUReportAccelerometer report) {
@@ -90,9 +201,7 @@ void ImuConverter::fillImuMsg(depthai_ros_msgs::msg::ImuWithMagneticField& msg,
 }
 
 void ImuConverter::toRosMsg(std::shared_ptr<dai::IMUData> inData, std::deque<ImuMsgs::Imu>& outImuMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
-    }
+    size_t firstNew = outImuMsgs.size();
     if(_syncMode != ImuSyncMethod::COPY) {
         FillImuData_LinearInterpolation(inData->packets, outImuMsgs);
     } else {
@@ -116,12 +225,15 @@ void ImuConverter::toRosMsg(std::shared_ptr<dai::IMUData> inData, std::deque<Imu
             outImuMsgs.push_back(msg);
         }
     }
+    if(_frameBundling) {
+        for(size_t i = firstNew; i < outImuMsgs.size(); i++) {
+            keepForBundle(outImuMsgs[i]);
+        }
+    }
 }
 
 void ImuConverter::toRosDaiMsg(std::shared_ptr<dai::IMUData> inData, std::deque<depthai_ros_msgs::msg::ImuWithMagneticField>& outImuMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
-    }
+    size_t firstNew = outImuMsgs.size();
     if(_syncMode != ImuSyncMethod::COPY) {
         FillImuData_LinearInterpolation(inData->packets, outImuMsgs);
     } else {
@@ -140,6 +252,39 @@ void ImuConverter::toRosDaiMsg(std::shared_ptr<dai::IMUData> inData, std::deque<
             outImuMsgs.push_back(msg);
         }
     }
+    if(_frameBundling) {
+        for(size_t i = firstNew; i < outImuMsgs.size(); i++) {
+            ImuMsgs::Imu imu = outImuMsgs[i].imu;
+            imu.header = outImuMsgs[i].header;
+            keepForBundle(imu);
+        }
+    }
+}
+
+void ImuConverter::toRosBatchMsg(std::shared_ptr<dai::IMUData> inData, depthai_ros_msgs::msg::ImuBatch& outBatch) {
+    outBatch.imu.clear();
+    outBatch.field.clear();
+    if(_enable_magn) {
+        std::deque<depthai_ros_msgs::msg::ImuWithMagneticField> samples;
+        toRosDaiMsg(inData, samples);
+        outBatch.imu.reserve(samples.size());
+        outBatch.field.reserve(samples.size());
+        for(auto& sample : samples) {
+            sample.imu.header = sample.header;
+            sample.field.header = sample.header;
+            outBatch.imu.push_back(std::move(sample.imu));
+            outBatch.field.push_back(std::move(sample.field));
+        }
+    } else {
+        std::deque<ImuMsgs::Imu> samples;
+        toRosMsg(inData, samples);
+        outBatch.imu.assign(std::make_move_iterator(samples.begin()), std::make_move_iterator(samples.end()));
+    }
+    if(outBatch.imu.empty()) {
+        outBatch.header.frame_id = _frameName;
+    } else {
+        outBatch.header = outBatch.imu.back().header;
+    }
 }
 
 }  // namespace ros
@@ -0,0 +1,128 @@
+#include "depthai_bridge/JpegDecoder.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "opencv2/imgcodecs.hpp"
+
+namespace dai {
+
+namespace ros {
+
+JpegDecoder::JpegDecoder(int scale) {
+    setScale(scale);
+}
+
+JpegDecoder::JpegDecoder(const JpegDecoder& other) : _scale(other._scale) {}
+
+JpegDecoder& JpegDecoder::operator=(const JpegDecoder& other) {
+    if(this != &other) {
+        _scale = other._scale;
+        _buffer = cv::Mat();
+    }
+    return *this;
+}
+
+JpegDecoder::~JpegDecoder() = default;
+
+void JpegDecoder::setScale(int scale) {
+    if(scale != 1 && scale != 2 && scale != 4 && scale != 8) {
+        throw std::runtime_error("JPEG decode scale must be 1, 2, 4 or 8");
+    }
+    _scale = scale;
+}
+
+int JpegDecoder::getScale() const {
+    return _scale;
+}
+
+bool JpegDecoder::readSize(const uint8_t* data, size_t size, int& width, int& height) {
+    if(size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return false;
+    }
+    size_t pos = 2;
+    while(pos + 4 <= size) {
+        if(data[pos] != 0xFF) {
+            return false;
+        }
+        uint8_t marker = data[pos + 1];
+        if(marker == 0xFF) {
+            // Fill byte
+            pos++;
+            continue;
+        }
+        if(marker == 0x01 || (marker >= 0xD0 && marker <= 0xD7)) {
+            // Markers without payload
+            pos += 2;
+            continue;
+        }
+        if(marker == 0xDA || marker == 0xD9) {
+            // Start of scan or end of image before any frame header
+            return false;
+        }
+        size_t segmentLength = (static_cast<size_t>(data[pos + 2]) << 8) | data[pos + 3];
+        bool isSOF = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+        if(isSOF) {
+            if(pos + 9 > size) {
+                return false;
+            }
+            height = (data[pos + 5] << 8) | data[pos + 6];
+            width = (data[pos + 7] << 8) | data[pos + 8];
+            return width > 0 && height > 0;
+        }
+        pos += 2 + segmentLength;
+    }
+    return false;
+}
+
+int JpegDecoder::scaledFlags(int flags) const {
+    switch(_scale) {
+        case 2:
+            return flags | cv::IMREAD_REDUCED_GRAYSCALE_2;
+        case 4:
+            return flags | cv::IMREAD_REDUCED_GRAYSCALE_4;
+        case 8:
+            return flags | cv::IMREAD_REDUCED_GRAYSCALE_8;
+        default:
+            return flags;
+    }
+}
+
+const cv::Mat& JpegDecoder::decode(const std::vector<uint8_t>& data, int flags) {
+    // Passing the previous result as destination lets OpenCV reuse its allocation when the size does not change.
+    cv::imdecode(cv::Mat(1, static_cast<int>(data.size()), CV_8UC1, const_cast<uint8_t*>(data.data())), scaledFlags(flags), &_buffer);
+    if(_buffer.empty()) {
+        throw std::runtime_error("Failed to decode JPEG frame");
+    }
+    return _buffer;
+}
+
+void JpegDecoder::decodeInto(const std::vector<uint8_t>& data, int flags, int cvType, std::vector<uint8_t>& outData, int& width, int& height) {
+    int fullWidth, fullHeight;
+    if(!readSize(data.data(), data.size(), fullWidth, fullHeight)) {
+        throw std::runtime_error("Failed to read JPEG frame header");
+    }
+    // libjpeg rounds scaled dimensions up
+    width = (fullWidth + _scale - 1) / _scale;
+    height = (fullHeight + _scale - 1) / _scale;
+    size_t rowSize = static_cast<size_t>(width) * CV_ELEM_SIZE(cvType);
+    outData.resize(rowSize * height);
+    cv::Mat dst(height, width, cvType, outData.data(), rowSize);
+    cv::imdecode(cv::Mat(1, static_cast<int>(data.size()), CV_8UC1, const_cast<uint8_t*>(data.data())), scaledFlags(flags), &dst);
+    if(dst.empty()) {
+        throw std::runtime_error("Failed to decode JPEG frame");
+    }
+    if(dst.data != outData.data()) {
+        // Decoder produced a different size or type than expected and allocated its own buffer.
+        width = dst.cols;
+        height = dst.rows;
+        rowSize = static_cast<size_t>(width) * dst.elemSize();
+        outData.resize(rowSize * height);
+        for(int row = 0; row < height; row++) {
+            std::memcpy(outData.data() + row * rowSize, dst.ptr(row), rowSize);
+        }
+    }
+}
+
+}  // namespace ros
+}  // namespace dai
@@ -0,0 +1,227 @@
+#include "depthai_bridge/PlanarKernels.hpp"
+
+#if(defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+    #define DEPTHAI_BRIDGE_X86_KERNELS
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+    #define DEPTHAI_BRIDGE_NEON_KERNELS
+    #include <arm_neon.h>
+#endif
+
+namespace dai {
+
+namespace ros {
+
+namespace {
+
+void interleaveScalar(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels) {
+    for(size_t i = 0; i < numPixels; i++) {
+        dst[i * 3 + 0] = plane0[i];
+        dst[i * 3 + 1] = plane1[i];
+        dst[i * 3 + 2] = plane2[i];
+    }
+}
+
+void deinterleaveScalar(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels) {
+    for(size_t i = 0; i < numPixels; i++) {
+        plane0[i] = src[i * 3 + 0];
+        plane1[i] = src[i * 3 + 1];
+        plane2[i] = src[i * 3 + 2];
+    }
+}
+
+#ifdef DEPTHAI_BRIDGE_X86_KERNELS
+
+/**
+ * pshufb masks for 16 pixels. interleave[block][channel] gathers the bytes of output block (16 bytes) from one plane register,
+ * deinterleave[channel][block] gathers one plane from one 16 byte input block. 0x80 zeroes the byte so the three shuffles can be OR'ed.
+ */
+struct ShuffleMasks {
+    alignas(16) uint8_t interleave[3][3][16];
+    alignas(16) uint8_t deinterleave[3][3][16];
+
+    ShuffleMasks() {
+        for(int block = 0; block < 3; block++) {
+            for(int c = 0; c < 3; c++) {
+                for(int k = 0; k < 16; k++) {
+                    int outIdx = block * 16 + k;
+                    interleave[block][c][k] = (outIdx % 3 == c) ? static_cast<uint8_t>(outIdx / 3) : 0x80;
+                    int inIdx = k * 3 + c;
+                    deinterleave[c][block][k] = (inIdx / 16 == block) ? static_cast<uint8_t>(inIdx % 16) : 0x80;
+                }
+            }
+        }
+    }
+};
+
+const ShuffleMasks& shuffleMasks() {
+    static const ShuffleMasks masks;
+    return masks;
+}
+
+__attribute__((target("ssse3"))) void interleaveSSSE3(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels) {
+    const auto& m = shuffleMasks();
+    __m128i mask[3][3];
+    for(int block = 0; block < 3; block++) {
+        for(int c = 0; c < 3; c++) {
+            mask[block][c] = _mm_load_si128(reinterpret_cast<const __m128i*>(m.interleave[block][c]));
+        }
+    }
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane0 + i));
+        __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane1 + i));
+        __m128i p2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(plane2 + i));
+        for(int block = 0; block < 3; block++) {
+            __m128i out = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(p0, mask[block][0]), _mm_shuffle_epi8(p1, mask[block][1])),
+                                       _mm_shuffle_epi8(p2, mask[block][2]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3 + block * 16), out);
+        }
+    }
+    interleaveScalar(plane0 + i, plane1 + i, plane2 + i, dst + i * 3, numPixels - i);
+}
+
+__attribute__((target("ssse3"))) void deinterleaveSSSE3(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels) {
+    const auto& m = shuffleMasks();
+    __m128i mask[3][3];
+    for(int c = 0; c < 3; c++) {
+        for(int block = 0; block < 3; block++) {
+            mask[c][block] = _mm_load_si128(reinterpret_cast<const __m128i*>(m.deinterleave[c][block]));
+        }
+    }
+    uint8_t* planes[3] = {plane0, plane1, plane2};
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        __m128i in0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+        __m128i in1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3 + 16));
+        __m128i in2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3 + 32));
+        for(int c = 0; c < 3; c++) {
+            __m128i out =
+                _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in0, mask[c][0]), _mm_shuffle_epi8(in1, mask[c][1])), _mm_shuffle_epi8(in2, mask[c][2]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[c] + i), out);
+        }
+    }
+    deinterleaveScalar(src + i * 3, plane0 + i, plane1 + i, plane2 + i, numPixels - i);
+}
+
+// vpshufb works within 128 bit lanes, so each lane runs the SSSE3 masks on its own 16 pixels and the lanes are
+// reassembled with vperm2i128 to get contiguous 96 byte groups.
+__attribute__((target("avx2"))) void interleaveAVX2(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels) {
+    const auto& m = shuffleMasks();
+    __m256i mask[3][3];
+    for(int block = 0; block < 3; block++) {
+        for(int c = 0; c < 3; c++) {
+            mask[block][c] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(m.interleave[block][c])));
+        }
+    }
+    size_t i = 0;
+    for(; i + 32 <= numPixels; i += 32) {
+        __m256i p0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(plane0 + i));
+        __m256i p1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(plane1 + i));
+        __m256i p2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(plane2 + i));
+        __m256i out[3];
+        for(int block = 0; block < 3; block++) {
+            out[block] = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(p0, mask[block][0]), _mm256_shuffle_epi8(p1, mask[block][1])),
+                                         _mm256_shuffle_epi8(p2, mask[block][2]));
+        }
+        // Low lanes hold output bytes 0-47, high lanes bytes 48-95.
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 3), _mm256_permute2x128_si256(out[0], out[1], 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 3 + 32), _mm256_permute2x128_si256(out[2], out[0], 0x30));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 3 + 64), _mm256_permute2x128_si256(out[1], out[2], 0x31));
+    }
+    interleaveSSSE3(plane0 + i, plane1 + i, plane2 + i, dst + i * 3, numPixels - i);
+}
+
+__attribute__((target("avx2"))) void deinterleaveAVX2(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels) {
+    const auto& m = shuffleMasks();
+    __m256i mask[3][3];
+    for(int c = 0; c < 3; c++) {
+        for(int block = 0; block < 3; block++) {
+            mask[c][block] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(m.deinterleave[c][block])));
+        }
+    }
+    uint8_t* planes[3] = {plane0, plane1, plane2};
+    size_t i = 0;
+    for(; i + 32 <= numPixels; i += 32) {
+        __m256i in0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 3));
+        __m256i in1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 3 + 32));
+        __m256i in2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 3 + 64));
+        // Regroup so the low lanes hold input bytes 0-47 and the high lanes bytes 48-95.
+        __m256i block0 = _mm256_permute2x128_si256(in0, in1, 0x30);
+        __m256i block1 = _mm256_permute2x128_si256(in0, in2, 0x21);
+        __m256i block2 = _mm256_permute2x128_si256(in1, in2, 0x30);
+        for(int c = 0; c < 3; c++) {
+            __m256i out = _mm256_or_si256(_mm256_or_si256(_mm256_shuffle_epi8(block0, mask[c][0]), _mm256_shuffle_epi8(block1, mask[c][1])),
+                                          _mm256_shuffle_epi8(block2, mask[c][2]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(planes[c] + i), out);
+        }
+    }
+    deinterleaveSSSE3(src + i * 3, plane0 + i, plane1 + i, plane2 + i, numPixels - i);
+}
+
+#endif
+
+#ifdef DEPTHAI_BRIDGE_NEON_KERNELS
+
+void interleaveNEON(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels) {
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        uint8x16x3_t px;
+        px.val[0] = vld1q_u8(plane0 + i);
+        px.val[1] = vld1q_u8(plane1 + i);
+        px.val[2] = vld1q_u8(plane2 + i);
+        vst3q_u8(dst + i * 3, px);
+    }
+    interleaveScalar(plane0 + i, plane1 + i, plane2 + i, dst + i * 3, numPixels - i);
+}
+
+void deinterleaveNEON(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels) {
+    size_t i = 0;
+    for(; i + 16 <= numPixels; i += 16) {
+        uint8x16x3_t px = vld3q_u8(src + i * 3);
+        vst1q_u8(plane0 + i, px.val[0]);
+        vst1q_u8(plane1 + i, px.val[1]);
+        vst1q_u8(plane2 + i, px.val[2]);
+    }
+    deinterleaveScalar(src + i * 3, plane0 + i, plane1 + i, plane2 + i, numPixels - i);
+}
+
+#endif
+
+const PlanarKernelSet& kernels() {
+    static const PlanarKernelSet selected = supportedPlanarKernels().back();
+    return selected;
+}
+
+}  // namespace
+
+void interleavePlanes(const uint8_t* plane0, const uint8_t* plane1, const uint8_t* plane2, uint8_t* dst, size_t numPixels) {
+    kernels().interleave(plane0, plane1, plane2, dst, numPixels);
+}
+
+void deinterleavePlanes(const uint8_t* src, uint8_t* plane0, uint8_t* plane1, uint8_t* plane2, size_t numPixels) {
+    kernels().deinterleave(src, plane0, plane1, plane2, numPixels);
+}
+
+const char* planarKernelName() {
+    return kernels().name;
+}
+
+std::vector<PlanarKernelSet> supportedPlanarKernels() {
+    std::vector<PlanarKernelSet> sets = {{"scalar", interleaveScalar, deinterleaveScalar}};
+#if defined(DEPTHAI_BRIDGE_X86_KERNELS)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("ssse3")) {
+        sets.push_back({"ssse3", interleaveSSSE3, deinterleaveSSSE3});
+        if(__builtin_cpu_supports("avx2")) {
+            sets.push_back({"avx2", interleaveAVX2, deinterleaveAVX2});
+        }
+    }
+#elif defined(DEPTHAI_BRIDGE_NEON_KERNELS)
+    sets.push_back({"neon", interleaveNEON, deinterleaveNEON});
+#endif
+    return sets;
+}
+
+}  // namespace ros
+}  // namespace dai
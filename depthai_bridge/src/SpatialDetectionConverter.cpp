@@ -10,30 +10,37 @@ SpatialDetectionConverter::SpatialDetectionConverter(std::string frameName, int
       _width(width),
       _height(height),
       _normalized(normalized),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 SpatialDetectionConverter::~SpatialDetectionConverter() = default;
 
 void SpatialDetectionConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void SpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::SpatialImgDetections> inNetData,
                                          std::deque<SpatialMessages::SpatialDetectionArray>& opDetectionMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
+    opDetectionMsgs.emplace_back();
+    fillMsg(inNetData, opDetectionMsgs.back());
+}
+
+void SpatialDetectionConverter::toRosMsgInPlace(std::shared_ptr<dai::SpatialImgDetections> inNetData,
+                                                std::unique_ptr<SpatialMessages::SpatialDetectionArray>& opDetectionMsg) {
+    if(!opDetectionMsg) {
+        opDetectionMsg = std::make_unique<SpatialMessages::SpatialDetectionArray>();
     }
+    fillMsg(inNetData, *opDetectionMsg);
+}
+
+void SpatialDetectionConverter::fillMsg(const std::shared_ptr<dai::SpatialImgDetections>& inNetData, SpatialMessages::SpatialDetectionArray& opDetectionMsg) {
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         tstamp = inNetData->getTimestampDevice();
     else
         tstamp = inNetData->getTimestamp();
-    SpatialMessages::SpatialDetectionArray opDetectionMsg;
 
-    opDetectionMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    opDetectionMsg.header.stamp = _clockSync->toRosTime(tstamp);
     opDetectionMsg.header.frame_id = _frameName;
     opDetectionMsg.detections.resize(inNetData->detections.size());
 
@@ -80,31 +87,38 @@ void SpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::SpatialImgDetectio
         opDetectionMsg.detections[i].position.y = inNetData->detections[i].spatialCoordinates.y / 1000;
         opDetectionMsg.detections[i].position.z = inNetData->detections[i].spatialCoordinates.z / 1000;
     }
-
-    opDetectionMsgs.push_back(opDetectionMsg);
 }
 
 SpatialDetectionArrayPtr SpatialDetectionConverter::toRosMsgPtr(std::shared_ptr<dai::SpatialImgDetections> inNetData) {
     std::deque<SpatialMessages::SpatialDetectionArray> msgQueue;
     toRosMsg(inNetData, msgQueue);
-    auto msg = msgQueue.front();
-    SpatialDetectionArrayPtr ptr = std::make_shared<SpatialMessages::SpatialDetectionArray>(msg);
+    auto msg = std::move(msgQueue.front());
+    SpatialDetectionArrayPtr ptr = std::make_shared<SpatialMessages::SpatialDetectionArray>(std::move(msg));
     return ptr;
 }
 
 void SpatialDetectionConverter::toRosVisionMsg(std::shared_ptr<dai::SpatialImgDetections> inNetData,
                                                std::deque<vision_msgs::msg::Detection3DArray>& opDetectionMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
+    opDetectionMsgs.emplace_back();
+    fillVisionMsg(inNetData, opDetectionMsgs.back());
+}
+
+void SpatialDetectionConverter::toRosVisionMsgInPlace(std::shared_ptr<dai::SpatialImgDetections> inNetData,
+                                                      std::unique_ptr<vision_msgs::msg::Detection3DArray>& opDetectionMsg) {
+    if(!opDetectionMsg) {
+        opDetectionMsg = std::make_unique<vision_msgs::msg::Detection3DArray>();
     }
+    fillVisionMsg(inNetData, *opDetectionMsg);
+}
+
+void SpatialDetectionConverter::fillVisionMsg(const std::shared_ptr<dai::SpatialImgDetections>& inNetData, vision_msgs::msg::Detection3DArray& opDetectionMsg) {
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         tstamp = inNetData->getTimestampDevice();
     else
         tstamp = inNetData->getTimestamp();
-    vision_msgs::msg::Detection3DArray opDetectionMsg;
 
-    opDetectionMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    opDetectionMsg.header.stamp = _clockSync->toRosTime(tstamp);
     opDetectionMsg.header.frame_id = _frameName;
     opDetectionMsg.detections.resize(inNetData->detections.size());
 
@@ -143,8 +157,6 @@ void SpatialDetectionConverter::toRosVisionMsg(std::shared_ptr<dai::SpatialImgDe
         opDetectionMsg.detections[i].results[0].pose.pose.position.y = inNetData->detections[i].spatialCoordinates.y / 1000;
         opDetectionMsg.detections[i].results[0].pose.pose.position.z = inNetData->detections[i].spatialCoordinates.z / 1000;
     }
-
-    opDetectionMsgs.push_back(opDetectionMsg);
 }
 
 }  // namespace ros
@@ -0,0 +1,109 @@
+#include "depthai_bridge/SubscriptionTracker.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+#include "depthai_bridge/depthaiUtility.hpp"
+
+namespace dai {
+
+namespace ros {
+
+// Longest wait for a graph change, bounds how long shutdown takes and is the re-check period while a change settles.
+static const std::chrono::milliseconds GRAPH_WAIT_TIMEOUT{100};
+// How long flags keep being re-checked after a graph change, for matches the middleware completes after the graph event.
+static const std::chrono::milliseconds MATCH_SETTLE_TIME{1000};
+
+SubscriptionTracker::SubscriptionTracker(rclcpp::node_interfaces::NodeGraphInterface::SharedPtr graph) : _graph(graph) {
+    _thread = std::thread(&SubscriptionTracker::run, this);
+}
+
+SubscriptionTracker::~SubscriptionTracker() {
+    _running = false;
+    if(_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+std::shared_ptr<SubscriptionTracker> SubscriptionTracker::getInstance(rclcpp::node_interfaces::NodeGraphInterface::SharedPtr graph) {
+    static std::mutex instancesMutex;
+    static std::map<const rclcpp::node_interfaces::NodeGraphInterface*, std::weak_ptr<SubscriptionTracker>> instances;
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    for(auto it = instances.begin(); it != instances.end();) {
+        if(it->second.expired()) {
+            it = instances.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    auto tracker = instances[graph.get()].lock();
+    if(!tracker) {
+        tracker = std::make_shared<SubscriptionTracker>(graph);
+        instances[graph.get()] = tracker;
+    }
+    return tracker;
+}
+
+SubscriptionTracker::Flag SubscriptionTracker::track(std::function<bool()> hasSubscribers) {
+    // Evaluated under the lock, so a graph change can not slip in between the first check and the flag being registered.
+    std::lock_guard<std::mutex> lock(_entriesMutex);
+    auto flag = std::make_shared<std::atomic<bool>>(hasSubscribers());
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(), [](const Entry& entry) { return entry.flag.expired(); }), _entries.end());
+    _entries.push_back(Entry{std::move(hasSubscribers), flag});
+    return flag;
+}
+
+SubscriptionTracker::Flag SubscriptionTracker::track(const image_transport::Publisher& pub) {
+    return track([pub]() { return pub.getNumSubscribers() > 0; });
+}
+
+SubscriptionTracker::Flag SubscriptionTracker::track(const image_transport::CameraPublisher& pub) {
+    return track([pub]() { return pub.getNumSubscribers() > 0; });
+}
+
+void SubscriptionTracker::refresh() {
+    std::lock_guard<std::mutex> lock(_entriesMutex);
+    for(auto it = _entries.begin(); it != _entries.end();) {
+        auto flag = it->flag.lock();
+        if(!flag) {
+            // Nobody checks this flag anymore, also releases the publisher the check may hold on to.
+            it = _entries.erase(it);
+            continue;
+        }
+        flag->store(it->hasSubscribers(), std::memory_order_relaxed);
+        ++it;
+    }
+}
+
+void SubscriptionTracker::run() {
+    rclcpp::Event::SharedPtr event;
+    try {
+        event = _graph->get_graph_event();
+    } catch(const std::exception& e) {
+        DEPTHAI_ROS_ERROR_STREAM("SubscriptionTracker", "Failed to get graph event, subscriber flags will not be updated: " << e.what());
+        return;
+    }
+    auto settleUntil = std::chrono::steady_clock::time_point::min();
+    while(_running && rclcpp::ok()) {
+        try {
+            _graph->wait_for_graph_change(event, GRAPH_WAIT_TIMEOUT);
+        } catch(const std::exception&) {
+            // Node or context is shutting down.
+            break;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if(event->check_and_clear()) {
+            settleUntil = now + MATCH_SETTLE_TIME;
+        } else if(now > settleUntil) {
+            // Quiet graph, nothing to refresh.
+            continue;
+        }
+        // The graph event can fire before the middleware has matched the new subscription to the publisher, so counts read right
+        // after it may still be stale. Timeouts within the settle time after an event refresh again to pick up such late matches.
+        refresh();
+    }
+}
+
+}  // namespace ros
+}  // namespace dai
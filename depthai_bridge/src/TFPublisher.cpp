@@ -3,9 +3,20 @@
 #include <dirent.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <memory>
+#include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -229,22 +240,176 @@ std::string TFPublisher::getURDF() {
         args = _customXacroArgs;
     }
     if(_customURDFLocation.empty()) {
-        path = ament_index_cpp::get_package_share_directory("depthai_descriptions") + "/urdf/base_descr.urdf.xacro ";
+        path = ament_index_cpp::get_package_share_directory("depthai_descriptions") + "/urdf/base_descr.urdf.xacro";
     } else {
-        path = _customURDFLocation + " ";
+        path = _customURDFLocation;
     }
-    std::string cmd = "xacro " + path + args;
+    auto start = std::chrono::steady_clock::now();
+    std::string cachePath = getURDFCachePath(path, args);
+    if(!cachePath.empty()) {
+        std::ifstream cacheFile(cachePath);
+        if(cacheFile) {
+            std::stringstream cached;
+            cached << cacheFile.rdbuf();
+            if(!cached.str().empty()) {
+                RCLCPP_INFO(_logger,
+                            "Loaded URDF from cache %s in %s ms",
+                            cachePath.c_str(),
+                            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()).c_str());
+                return cached.str();
+            }
+        }
+    }
+
+    std::string result = runXacro(path, args);
+    RCLCPP_INFO(_logger,
+                "Generated URDF in %s ms",
+                std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()).c_str());
+    if(!cachePath.empty() && !result.empty()) {
+        // Written under a unique name and renamed, so cameras starting in parallel, in one process or several, never read a
+        // partial file or write into each other's.
+        std::string tmpPath = cachePath + ".XXXXXX";
+        int fd = mkstemp(&tmpPath[0]);
+        bool written = fd >= 0;
+        if(written) {
+            fchmod(fd, 0644);
+            size_t offset = 0;
+            while(written && offset < result.size()) {
+                ssize_t count = write(fd, result.data() + offset, result.size() - offset);
+                if(count < 0 && errno == EINTR) {
+                    continue;
+                }
+                written = count > 0;
+                offset += written ? static_cast<size_t>(count) : 0;
+            }
+            written = close(fd) == 0 && written;
+        }
+        if(!written || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+            RCLCPP_WARN(_logger, "Unable to write URDF cache %s", cachePath.c_str());
+            if(fd >= 0) {
+                std::remove(tmpPath.c_str());
+            }
+        }
+    }
+    return result;
+}
+
+std::string TFPublisher::runXacro(const std::string& path, const std::string& args) {
+    std::string cmd = "xacro " + path + " " + args;
     RCLCPP_DEBUG(_logger, "Xacro command: %s", cmd.c_str());
     std::array<char, 128> buffer;
     std::string result;
-    std::unique_ptr<FILE, decltype(&pclose)> pipe(popen(cmd.c_str(), "r"), pclose);
+    FILE* pipe = popen(cmd.c_str(), "r");
     if(!pipe) {
         throw std::runtime_error("popen() failed!");
     }
-    while(fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
+    while(fgets(buffer.data(), buffer.size(), pipe) != nullptr) {
         result += buffer.data();
     }
+    if(pclose(pipe) != 0) {
+        RCLCPP_ERROR(_logger, "Xacro failed, command: %s", cmd.c_str());
+        return "";
+    }
     return result;
 }
+
+std::string TFPublisher::getURDFCachePath(const std::string& path, const std::string& args) {
+    std::string cacheDir;
+    const char* rosHome = std::getenv("ROS_HOME");
+    const char* home = std::getenv("HOME");
+    if(rosHome != nullptr) {
+        cacheDir = rosHome;
+    } else if(home != nullptr) {
+        cacheDir = std::string(home) + "/.ros";
+    } else {
+        return "";
+    }
+    mkdir(cacheDir.c_str(), 0755);
+    cacheDir += "/depthai_urdf_cache";
+    if(mkdir(cacheDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        RCLCPP_WARN(_logger, "Unable to create URDF cache directory %s, URDF will not be cached", cacheDir.c_str());
+        return "";
+    }
+
+    // 64 bit FNV-1a over the arguments and the xacro sources.
+    uint64_t hash = 14695981039346656037ULL;
+    hashBytes(args, hash);
+    std::set<std::string> visited;
+    if(!hashXacroFile(path, hash, visited)) {
+        return "";
+    }
+
+    std::stringstream name;
+    name << cacheDir << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".urdf";
+    return name.str();
+}
+
+bool TFPublisher::hashXacroFile(const std::string& path, uint64_t& hash, std::set<std::string>& visited) {
+    char* resolved = realpath(path.c_str(), nullptr);
+    if(resolved == nullptr) {
+        return false;
+    }
+    std::string canonicalPath(resolved);
+    free(resolved);
+    // Files included more than once, or in a cycle, are hashed on first use only.
+    if(!visited.insert(canonicalPath).second) {
+        return true;
+    }
+    std::ifstream file(canonicalPath);
+    if(!file) {
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string data = contents.str();
+    hashBytes(canonicalPath, hash);
+    hashBytes(data, hash);
+
+    const std::string dir = canonicalPath.substr(0, canonicalPath.find_last_of('/'));
+    const std::string includeTag = "xacro:include";
+    const std::string findPrefix = "$(find ";
+    for(size_t pos = data.find(includeTag); pos != std::string::npos; pos = data.find(includeTag, pos + includeTag.size())) {
+        size_t attr = data.find("filename=", pos);
+        size_t tagEnd = data.find('>', pos);
+        if(attr == std::string::npos || attr > tagEnd || attr + 10 >= data.size()) {
+            continue;
+        }
+        char quote = data[attr + 9];
+        size_t valueEnd = data.find(quote, attr + 10);
+        if(valueEnd == std::string::npos) {
+            continue;
+        }
+        std::string include = data.substr(attr + 10, valueEnd - attr - 10);
+        if(include.compare(0, findPrefix.size(), findPrefix) == 0) {
+            size_t findEnd = include.find(')');
+            if(findEnd == std::string::npos) {
+                continue;
+            }
+            try {
+                std::string package = include.substr(findPrefix.size(), findEnd - findPrefix.size());
+                include = ament_index_cpp::get_package_share_directory(package) + include.substr(findEnd + 1);
+            } catch(const std::exception&) {
+                continue;
+            }
+        } else if(!include.empty() && include[0] != '/') {
+            include = dir + "/" + include;
+        }
+        // Other substitutions depend on the arguments, which are already part of the hash.
+        if(include.find("$(") == std::string::npos) {
+            hashXacroFile(include, hash, visited);
+        }
+    }
+    return true;
+}
+
+void TFPublisher::hashBytes(const std::string& data, uint64_t& hash) {
+    for(unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    // Separator, so that moving bytes between consecutive strings changes the hash.
+    hash ^= 0xff;
+    hash *= 1099511628211ULL;
+}
 }  // namespace ros
 }  // namespace dai
\ No newline at end of file
@@ -13,18 +13,29 @@ TrackDetectionConverter::TrackDetectionConverter(std::string frameName, int widt
       _height(height),
       _normalized(normalized),
       _thresh(thresh),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 TrackDetectionConverter::~TrackDetectionConverter() = default;
 
 void TrackDetectionConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void TrackDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> trackData, std::deque<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsgs) {
+    opDetectionMsgs.emplace_back();
+    fillMsg(trackData, opDetectionMsgs.back());
+}
+
+void TrackDetectionConverter::toRosMsgInPlace(std::shared_ptr<dai::Tracklets> trackData,
+                                              std::unique_ptr<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsg) {
+    if(!opDetectionMsg) {
+        opDetectionMsg = std::make_unique<depthai_ros_msgs::msg::TrackDetection2DArray>();
+    }
+    fillMsg(trackData, *opDetectionMsg);
+}
+
+void TrackDetectionConverter::fillMsg(const std::shared_ptr<dai::Tracklets>& trackData, depthai_ros_msgs::msg::TrackDetection2DArray& opDetectionMsg) {
     // setting the header
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
@@ -32,14 +43,13 @@ void TrackDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> trackData
     else
         tstamp = trackData->getTimestamp();
 
-    depthai_ros_msgs::msg::TrackDetection2DArray opDetectionMsg;
-    opDetectionMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    opDetectionMsg.header.stamp = _clockSync->toRosTime(tstamp);
     opDetectionMsg.header.frame_id = _frameName;
     opDetectionMsg.detections.resize(trackData->tracklets.size());
 
     // publishing
     for(int i = 0; i < trackData->tracklets.size(); ++i) {
-        dai::Tracklet t = trackData->tracklets[i];
+        const dai::Tracklet& t = trackData->tracklets[i];
         dai::Rect roi;
         float xMin, yMin, xMax, yMax;
 
@@ -69,22 +79,18 @@ void TrackDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> trackData
         opDetectionMsg.detections[i].bbox.size_y = ySize;
 
         opDetectionMsg.detections[i].is_tracking = true;
-        std::stringstream track_id_str;
-        track_id_str << "" << t.id;
-        opDetectionMsg.detections[i].tracking_id = track_id_str.str();
+        opDetectionMsg.detections[i].tracking_id = std::to_string(t.id);
         opDetectionMsg.detections[i].tracking_age = t.age;
         opDetectionMsg.detections[i].tracking_status = static_cast<int32_t>(t.status);
     }
-
-    opDetectionMsgs.push_back(opDetectionMsg);
 }
 
 depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr TrackDetectionConverter::toRosMsgPtr(std::shared_ptr<dai::Tracklets> trackData) {
     std::deque<depthai_ros_msgs::msg::TrackDetection2DArray> msgQueue;
     toRosMsg(trackData, msgQueue);
-    auto msg = msgQueue.front();
+    auto msg = std::move(msgQueue.front());
 
-    depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr ptr = std::make_shared<depthai_ros_msgs::msg::TrackDetection2DArray>(msg);
+    depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr ptr = std::make_shared<depthai_ros_msgs::msg::TrackDetection2DArray>(std::move(msg));
 
     return ptr;
 }
@@ -14,19 +14,30 @@ TrackSpatialDetectionConverter::TrackSpatialDetectionConverter(
       _height(height),
       _normalized(normalized),
       _thresh(thresh),
-      _steadyBaseTime(std::chrono::steady_clock::now()),
-      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+      _clockSync(std::make_shared<ClockSync>()),
+      _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 TrackSpatialDetectionConverter::~TrackSpatialDetectionConverter() = default;
 
 void TrackSpatialDetectionConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void TrackSpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> trackData,
                                               std::deque<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsgs) {
+    opDetectionMsgs.emplace_back();
+    fillMsg(trackData, opDetectionMsgs.back());
+}
+
+void TrackSpatialDetectionConverter::toRosMsgInPlace(std::shared_ptr<dai::Tracklets> trackData,
+                                                     std::unique_ptr<depthai_ros_msgs::msg::TrackDetection2DArray>& opDetectionMsg) {
+    if(!opDetectionMsg) {
+        opDetectionMsg = std::make_unique<depthai_ros_msgs::msg::TrackDetection2DArray>();
+    }
+    fillMsg(trackData, *opDetectionMsg);
+}
+
+void TrackSpatialDetectionConverter::fillMsg(const std::shared_ptr<dai::Tracklets>& trackData, depthai_ros_msgs::msg::TrackDetection2DArray& opDetectionMsg) {
     // setting the header
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
@@ -34,14 +45,13 @@ void TrackSpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> tr
     else
         tstamp = trackData->getTimestamp();
 
-    depthai_ros_msgs::msg::TrackDetection2DArray opDetectionMsg;
-    opDetectionMsg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    opDetectionMsg.header.stamp = _clockSync->toRosTime(tstamp);
     opDetectionMsg.header.frame_id = _frameName;
     opDetectionMsg.detections.resize(trackData->tracklets.size());
 
     // publishing
     for(int i = 0; i < trackData->tracklets.size(); ++i) {
-        dai::Tracklet t = trackData->tracklets[i];
+        const dai::Tracklet& t = trackData->tracklets[i];
         dai::Rect roi;
         float xMin, yMin, xMax, yMax;
 
@@ -71,9 +81,7 @@ void TrackSpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> tr
         opDetectionMsg.detections[i].bbox.size_y = ySize;
 
         opDetectionMsg.detections[i].is_tracking = true;
-        std::stringstream track_id_str;
-        track_id_str << "" << t.id;
-        opDetectionMsg.detections[i].tracking_id = track_id_str.str();
+        opDetectionMsg.detections[i].tracking_id = std::to_string(t.id);
         opDetectionMsg.detections[i].tracking_age = t.age;
         opDetectionMsg.detections[i].tracking_status = static_cast<int32_t>(t.status);
 
@@ -82,16 +90,14 @@ void TrackSpatialDetectionConverter::toRosMsg(std::shared_ptr<dai::Tracklets> tr
         opDetectionMsg.detections[i].results[0].pose.pose.position.y = t.spatialCoordinates.y / 1000.0;
         opDetectionMsg.detections[i].results[0].pose.pose.position.z = t.spatialCoordinates.z / 1000.0;
     }
-
-    opDetectionMsgs.push_back(opDetectionMsg);
 }
 
 depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr TrackSpatialDetectionConverter::toRosMsgPtr(std::shared_ptr<dai::Tracklets> trackData) {
     std::deque<depthai_ros_msgs::msg::TrackDetection2DArray> msgQueue;
     toRosMsg(trackData, msgQueue);
-    auto msg = msgQueue.front();
+    auto msg = std::move(msgQueue.front());
 
-    depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr ptr = std::make_shared<depthai_ros_msgs::msg::TrackDetection2DArray>(msg);
+    depthai_ros_msgs::msg::TrackDetection2DArray::SharedPtr ptr = std::make_shared<depthai_ros_msgs::msg::TrackDetection2DArray>(std::move(msg));
 
     return ptr;
 }
@@ -7,34 +7,31 @@ namespace dai {
 namespace ros {
 
 TrackedFeaturesConverter::TrackedFeaturesConverter(std::string frameName, bool getBaseDeviceTimestamp)
-    : _frameName(frameName), _steadyBaseTime(std::chrono::steady_clock::now()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {
-    _rosBaseTime = rclcpp::Clock().now();
-}
+    : _frameName(frameName), _clockSync(std::make_shared<ClockSync>()), _getBaseDeviceTimestamp(getBaseDeviceTimestamp) {}
 
 TrackedFeaturesConverter::~TrackedFeaturesConverter() = default;
 
 void TrackedFeaturesConverter::updateRosBaseTime() {
-    updateBaseTime(_steadyBaseTime, _rosBaseTime, _totalNsChange);
+    _clockSync->update();
 }
 
 void TrackedFeaturesConverter::toRosMsg(std::shared_ptr<dai::TrackedFeatures> inFeatures, std::deque<depthai_ros_msgs::msg::TrackedFeatures>& featureMsgs) {
-    if(_updateRosBaseTimeOnToRosMsg) {
-        updateRosBaseTime();
-    }
     std::chrono::_V2::steady_clock::time_point tstamp;
     if(_getBaseDeviceTimestamp)
         tstamp = inFeatures->getTimestampDevice();
     else
         tstamp = inFeatures->getTimestamp();
 
-    depthai_ros_msgs::msg::TrackedFeatures msg;
+    featureMsgs.emplace_back();
+    depthai_ros_msgs::msg::TrackedFeatures& msg = featureMsgs.back();
 
-    msg.header.stamp = getFrameTime(_rosBaseTime, _steadyBaseTime, tstamp);
+    msg.header.stamp = _clockSync->toRosTime(tstamp);
     msg.header.frame_id = _frameName;
     msg.features.resize(inFeatures->trackedFeatures.size());
 
-    for(const auto& feature : inFeatures->trackedFeatures) {
-        depthai_ros_msgs::msg::TrackedFeature ft;
+    for(size_t i = 0; i < inFeatures->trackedFeatures.size(); i++) {
+        const auto& feature = inFeatures->trackedFeatures[i];
+        depthai_ros_msgs::msg::TrackedFeature& ft = msg.features[i];
         ft.header = msg.header;
         ft.position.x = feature.position.x;
         ft.position.y = feature.position.y;
@@ -42,9 +39,50 @@ void TrackedFeaturesConverter::toRosMsg(std::shared_ptr<dai::TrackedFeatures> in
         ft.id = feature.id;
         ft.harris_score = feature.harrisScore;
         ft.tracking_error = feature.trackingError;
-        msg.features.emplace_back(ft);
     }
-    featureMsgs.push_back(msg);
+}
+
+void TrackedFeaturesConverter::toRosPackedMsg(std::shared_ptr<dai::TrackedFeatures> inFeatures,
+                                              std::deque<depthai_ros_msgs::msg::PackedTrackedFeatures>& featureMsgs) {
+    featureMsgs.emplace_back();
+    fillPackedMsg(inFeatures, featureMsgs.back());
+}
+
+void TrackedFeaturesConverter::toRosPackedMsgInPlace(std::shared_ptr<dai::TrackedFeatures> inFeatures,
+                                                     std::unique_ptr<depthai_ros_msgs::msg::PackedTrackedFeatures>& featureMsg) {
+    if(!featureMsg) {
+        featureMsg = std::make_unique<depthai_ros_msgs::msg::PackedTrackedFeatures>();
+    }
+    fillPackedMsg(inFeatures, *featureMsg);
+}
+
+void TrackedFeaturesConverter::fillPackedMsg(const std::shared_ptr<dai::TrackedFeatures>& inFeatures,
+                                             depthai_ros_msgs::msg::PackedTrackedFeatures& featureMsg) {
+    std::chrono::_V2::steady_clock::time_point tstamp;
+    if(_getBaseDeviceTimestamp)
+        tstamp = inFeatures->getTimestampDevice();
+    else
+        tstamp = inFeatures->getTimestamp();
+
+    featureMsg.header.stamp = _clockSync->toRosTime(tstamp);
+    featureMsg.header.frame_id = _frameName;
+
+    const size_t numFeatures = inFeatures->trackedFeatures.size();
+    featureMsg.id.resize(numFeatures);
+    featureMsg.x.resize(numFeatures);
+    featureMsg.y.resize(numFeatures);
+    featureMsg.age.resize(numFeatures);
+    featureMsg.harris_score.resize(numFeatures);
+    featureMsg.tracking_error.resize(numFeatures);
+    for(size_t i = 0; i < numFeatures; i++) {
+        const auto& feature = inFeatures->trackedFeatures[i];
+        featureMsg.id[i] = feature.id;
+        featureMsg.x[i] = feature.position.x;
+        featureMsg.y[i] = feature.position.y;
+        featureMsg.age[i] = feature.age;
+        featureMsg.harris_score[i] = feature.harrisScore;
+        featureMsg.tracking_error[i] = feature.trackingError;
+    }
 }
 
 }  // namespace ros
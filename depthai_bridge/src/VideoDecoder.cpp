@@ -0,0 +1,208 @@
+#include "depthai_bridge/VideoDecoder.hpp"
+
+#include <stdexcept>
+
+#include "opencv2/core/mat.hpp"
+
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libswscale/swscale.h>
+}
+#endif
+
+namespace dai {
+
+namespace ros {
+
+struct VideoDecoder::Context {
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+    AVCodecContext* codecContext = nullptr;
+    AVPacket* packet = nullptr;
+    AVFrame* frame = nullptr;
+    SwsContext* swsContext = nullptr;
+
+    ~Context() {
+        sws_freeContext(swsContext);
+        av_frame_free(&frame);
+        av_packet_free(&packet);
+        avcodec_free_context(&codecContext);
+    }
+#endif
+};
+
+VideoDecoder::VideoDecoder(Codec codec) : _codec(codec) {}
+
+VideoDecoder::VideoDecoder(const VideoDecoder& other) : _codec(other._codec), _scale(other._scale) {}
+
+VideoDecoder& VideoDecoder::operator=(const VideoDecoder& other) {
+    if(this != &other) {
+        _codec = other._codec;
+        _scale = other._scale;
+        _waitForKeyframe = true;
+        _context.reset();
+    }
+    return *this;
+}
+
+VideoDecoder::~VideoDecoder() = default;
+
+bool VideoDecoder::isAvailable() {
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool VideoDecoder::isKeyframe(const uint8_t* data, size_t size, Codec codec) {
+    // Walk the NAL units until the first picture, parameter sets and SEI in front of it are skipped.
+    for(size_t pos = 0; pos + 3 < size; pos++) {
+        if(data[pos] != 0 || data[pos + 1] != 0 || data[pos + 2] != 1) {
+            continue;
+        }
+        uint8_t nalHeader = data[pos + 3];
+        if(codec == Codec::H264) {
+            int nalType = nalHeader & 0x1F;
+            if(nalType == 5) {
+                // IDR slice
+                return true;
+            }
+            if(nalType >= 1 && nalType <= 4) {
+                // Non-IDR slice
+                return false;
+            }
+        } else {
+            int nalType = (nalHeader >> 1) & 0x3F;
+            if(nalType >= 16 && nalType <= 23) {
+                // BLA, IDR or CRA picture
+                return true;
+            }
+            if(nalType < 16) {
+                // Non-IRAP picture
+                return false;
+            }
+        }
+        pos += 3;
+    }
+    return false;
+}
+
+void VideoDecoder::setCodec(Codec codec) {
+    if(codec != _codec) {
+        _codec = codec;
+        _waitForKeyframe = true;
+        _context.reset();
+    }
+}
+
+VideoDecoder::Codec VideoDecoder::getCodec() const {
+    return _codec;
+}
+
+void VideoDecoder::setScale(int scale) {
+    if(scale < 1) {
+        throw std::runtime_error("Video decode scale must be positive");
+    }
+    _scale = scale;
+}
+
+int VideoDecoder::getScale() const {
+    return _scale;
+}
+
+void VideoDecoder::reset() {
+    _waitForKeyframe = true;
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+    if(_context) {
+        avcodec_flush_buffers(_context->codecContext);
+    }
+#endif
+}
+
+void VideoDecoder::open() {
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+    const AVCodec* codec = avcodec_find_decoder(_codec == Codec::H265 ? AV_CODEC_ID_HEVC : AV_CODEC_ID_H264);
+    if(codec == nullptr) {
+        throw std::runtime_error("libavcodec has no decoder for the requested codec");
+    }
+    auto context = std::make_unique<Context>();
+    context->codecContext = avcodec_alloc_context3(codec);
+    context->packet = av_packet_alloc();
+    context->frame = av_frame_alloc();
+    if(context->codecContext == nullptr || context->packet == nullptr || context->frame == nullptr) {
+        throw std::runtime_error("Failed to allocate video decoder");
+    }
+    // Device encoders do not use B-frames, so frames can be returned as soon as their packet is in.
+    context->codecContext->flags |= AV_CODEC_FLAG_LOW_DELAY;
+    context->codecContext->thread_type = FF_THREAD_SLICE;
+    if(avcodec_open2(context->codecContext, codec, nullptr) < 0) {
+        throw std::runtime_error("Failed to open video decoder");
+    }
+    _context = std::move(context);
+#else
+    throw std::runtime_error("depthai_bridge was built without libavcodec, H.264/H.265 decoding is not available");
+#endif
+}
+
+bool VideoDecoder::decodeInto(const std::vector<uint8_t>& data, int cvType, std::vector<uint8_t>& outData, int& width, int& height) {
+    if(cvType != CV_8UC3 && cvType != CV_8UC1) {
+        throw std::runtime_error("Video decoder only outputs CV_8UC3 or CV_8UC1");
+    }
+    if(_waitForKeyframe) {
+        if(!isKeyframe(data.data(), data.size(), _codec)) {
+            return false;
+        }
+        _waitForKeyframe = false;
+    }
+    if(!_context) {
+        open();
+    }
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+    AVFrame* frame = _context->frame;
+    _context->packet->data = const_cast<uint8_t*>(data.data());
+    _context->packet->size = static_cast<int>(data.size());
+    int ret = avcodec_send_packet(_context->codecContext, _context->packet);
+    if(ret >= 0) {
+        ret = avcodec_receive_frame(_context->codecContext, frame);
+    }
+    if(ret == AVERROR(EAGAIN)) {
+        return false;
+    }
+    if(ret < 0) {
+        // Corrupt or truncated packet, later frames reference it so resync on the next keyframe.
+        reset();
+        return false;
+    }
+    width = (frame->width + _scale - 1) / _scale;
+    height = (frame->height + _scale - 1) / _scale;
+    AVPixelFormat outFormat = cvType == CV_8UC3 ? AV_PIX_FMT_BGR24 : AV_PIX_FMT_GRAY8;
+    _context->swsContext = sws_getCachedContext(_context->swsContext,
+                                                frame->width,
+                                                frame->height,
+                                                static_cast<AVPixelFormat>(frame->format),
+                                                width,
+                                                height,
+                                                outFormat,
+                                                SWS_BILINEAR,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr);
+    if(_context->swsContext == nullptr) {
+        av_frame_unref(frame);
+        throw std::runtime_error("Failed to create video color converter");
+    }
+    size_t rowSize = static_cast<size_t>(width) * CV_ELEM_SIZE(cvType);
+    outData.resize(rowSize * height);
+    uint8_t* dst[4] = {outData.data(), nullptr, nullptr, nullptr};
+    int dstStride[4] = {static_cast<int>(rowSize), 0, 0, 0};
+    sws_scale(_context->swsContext, frame->data, frame->linesize, 0, frame->height, dst, dstStride);
+    av_frame_unref(frame);
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace ros
+}  // namespace dai
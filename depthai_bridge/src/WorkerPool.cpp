@@ -0,0 +1,178 @@
+#include "depthai_bridge/WorkerPool.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+#include "depthai_bridge/depthaiUtility.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace dai {
+
+namespace ros {
+
+WorkerPool::Strand::Strand(WorkerPool* pool, Priority priority, size_t maxPending)
+    : _pool(pool), _priority(priority), _maxPending(maxPending > 0 ? maxPending : 1) {}
+
+void WorkerPool::Strand::post(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(_closed) {
+        return;
+    }
+    _pending.push_back(std::move(task));
+    while(_pending.size() > _maxPending) {
+        _pending.pop_front();
+        _droppedCount++;
+    }
+    if(!_scheduled) {
+        _scheduled = true;
+        auto self = shared_from_this();
+        _pool->submit([self]() { self->runNext(); }, _priority);
+    }
+}
+
+void WorkerPool::Strand::runNext() {
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(_closed || _pending.empty()) {
+            _scheduled = false;
+            return;
+        }
+        task = std::move(_pending.front());
+        _pending.pop_front();
+        _running = true;
+    }
+    try {
+        task();
+    } catch(const std::exception& e) {
+        DEPTHAI_ROS_ERROR_STREAM("WorkerPool", "Publisher task failed: " << e.what());
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running = false;
+    // One task per turn, so a busy stream goes back into the pool queue behind streams of the same priority.
+    if(!_closed && !_pending.empty()) {
+        auto self = shared_from_this();
+        _pool->submit([self]() { self->runNext(); }, _priority);
+    } else {
+        _scheduled = false;
+    }
+    _idleCv.notify_all();
+}
+
+void WorkerPool::Strand::close() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _closed = true;
+    _pending.clear();
+    _idleCv.wait(lock, [this]() { return !_running; });
+}
+
+uint64_t WorkerPool::Strand::getDroppedCount() const {
+    return _droppedCount;
+}
+
+bool WorkerPool::TaskOrder::operator()(const Task& a, const Task& b) const {
+    // priority_queue pops the largest element, so higher priority and then lower sequence number has to compare larger.
+    if(a.priority != b.priority) {
+        return a.priority < b.priority;
+    }
+    return a.sequence > b.sequence;
+}
+
+WorkerPool::WorkerPool(size_t numThreads, std::vector<int> cpuAffinity) {
+    if(numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for(size_t i = 0; i < numThreads; i++) {
+        _threads.emplace_back(&WorkerPool::run, this);
+        if(!cpuAffinity.empty()) {
+            setAffinity(_threads.back(), cpuAffinity[i % cpuAffinity.size()]);
+        }
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cv.notify_all();
+    for(auto& thread : _threads) {
+        if(thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+std::shared_ptr<WorkerPool> WorkerPool::getInstance() {
+    static std::mutex instanceMutex;
+    static std::weak_ptr<WorkerPool> instance;
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    auto pool = instance.lock();
+    if(!pool) {
+        pool = std::make_shared<WorkerPool>();
+        instance = pool;
+    }
+    return pool;
+}
+
+void WorkerPool::submit(std::function<void()> task, Priority priority) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(!_running) {
+            return;
+        }
+        _tasks.push(Task{priority, _sequence++, std::move(task)});
+    }
+    _cv.notify_one();
+}
+
+std::shared_ptr<WorkerPool::Strand> WorkerPool::createStrand(Priority priority, size_t maxPending) {
+    return std::make_shared<Strand>(this, priority, maxPending);
+}
+
+size_t WorkerPool::getNumThreads() const {
+    return _threads.size();
+}
+
+void WorkerPool::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true) {
+        _cv.wait(lock, [this]() { return !_running || !_tasks.empty(); });
+        if(!_running) {
+            break;
+        }
+        // top() is const, the task is moved out right before it is popped.
+        Task task = std::move(const_cast<Task&>(_tasks.top()));
+        _tasks.pop();
+        lock.unlock();
+        try {
+            task.function();
+        } catch(const std::exception& e) {
+            DEPTHAI_ROS_ERROR_STREAM("WorkerPool", "Task failed: " << e.what());
+        }
+        lock.lock();
+    }
+}
+
+void WorkerPool::setAffinity(std::thread& thread, int cpu) {
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    int ret = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    if(ret != 0) {
+        DEPTHAI_ROS_WARN_STREAM("WorkerPool", "Failed to pin worker thread to CPU " << std::to_string(cpu) << ", error " << std::to_string(ret));
+    }
+#else
+    (void)thread;
+    DEPTHAI_ROS_WARN_STREAM_ONCE("WorkerPool", "CPU affinity is only supported on Linux, ignoring it for CPU " << std::to_string(cpu));
+#endif
+}
+
+}  // namespace ros
+}  // namespace dai
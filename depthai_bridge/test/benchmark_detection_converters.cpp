@@ -0,0 +1,124 @@
+// Detection conversion with 100-detection payloads, as dense multi-class YOLO configs produce at 30 fps per camera. Compares the
+// deque path, where the caller copies the message out before publishing, with toRosMsgInPlace filling a caller owned message that
+// is either kept across frames (serialized publish) or moved out every frame (intra-process publish).
+#include <deque>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "depthai/pipeline/datatype/ImgDetections.hpp"
+#include "depthai/pipeline/datatype/SpatialImgDetections.hpp"
+#include "depthai/pipeline/datatype/Tracklets.hpp"
+#include "depthai_bridge/ImgDetectionConverter.hpp"
+#include "depthai_bridge/SpatialDetectionConverter.hpp"
+#include "depthai_bridge/TrackDetectionConverter.hpp"
+#include "depthai_bridge/TrackSpatialDetectionConverter.hpp"
+
+namespace {
+
+constexpr int kDetections = 100;
+constexpr int kWidth = 416;
+constexpr int kHeight = 416;
+
+enum class Output { Deque, ReusedMessage, MovedMessage };
+
+template <typename DetectionT>
+DetectionT makeDetection(int i) {
+    DetectionT det;
+    det.label = i % 80;
+    det.confidence = 0.9f;
+    det.xmin = static_cast<float>(i % 10) / 10.0f;
+    det.ymin = static_cast<float>(i / 10) / 10.0f;
+    det.xmax = det.xmin + 0.08f;
+    det.ymax = det.ymin + 0.08f;
+    return det;
+}
+
+std::shared_ptr<dai::ImgDetections> makeInput(dai::ImgDetections*) {
+    auto data = std::make_shared<dai::ImgDetections>();
+    for(int i = 0; i < kDetections; i++) {
+        data->detections.push_back(makeDetection<dai::ImgDetection>(i));
+    }
+    return data;
+}
+
+std::shared_ptr<dai::SpatialImgDetections> makeInput(dai::SpatialImgDetections*) {
+    auto data = std::make_shared<dai::SpatialImgDetections>();
+    for(int i = 0; i < kDetections; i++) {
+        auto det = makeDetection<dai::SpatialImgDetection>(i);
+        det.spatialCoordinates = dai::Point3f(100.0f * i, 50.0f, 2000.0f);
+        data->detections.push_back(det);
+    }
+    return data;
+}
+
+std::shared_ptr<dai::Tracklets> makeInput(dai::Tracklets*) {
+    auto data = std::make_shared<dai::Tracklets>();
+    for(int i = 0; i < kDetections; i++) {
+        dai::Tracklet t;
+        t.srcImgDetection = makeDetection<dai::ImgDetection>(i);
+        t.roi = dai::Rect(t.srcImgDetection.xmin, t.srcImgDetection.ymin, 0.08f, 0.08f);
+        t.id = i;
+        t.label = t.srcImgDetection.label;
+        t.age = 10;
+        t.status = dai::Tracklet::TrackingStatus::TRACKED;
+        t.spatialCoordinates = dai::Point3f(100.0f * i, 50.0f, 2000.0f);
+        data->tracklets.push_back(t);
+    }
+    return data;
+}
+
+template <typename ConverterT, typename InputT, typename MessageT>
+void BM_Convert(benchmark::State& state, Output output) {
+    ConverterT converter("camera_frame", kWidth, kHeight);
+    auto input = makeInput(static_cast<InputT*>(nullptr));
+    std::deque<MessageT> msgs;
+    std::unique_ptr<MessageT> msg;
+    for(auto _ : state) {
+        if(output == Output::Deque) {
+            converter.toRosMsg(input, msgs);
+            msg = std::make_unique<MessageT>(msgs.front());
+            msgs.pop_front();
+        } else {
+            converter.toRosMsgInPlace(input, msg);
+        }
+        benchmark::DoNotOptimize(msg->detections.data());
+        if(output != Output::ReusedMessage) {
+            // Stands in for the publisher taking ownership.
+            msg.reset();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kDetections);
+}
+
+void BM_ImgDetectionConverter(benchmark::State& state, Output output) {
+    BM_Convert<dai::ros::ImgDetectionConverter, dai::ImgDetections, vision_msgs::msg::Detection2DArray>(state, output);
+}
+
+void BM_SpatialDetectionConverter(benchmark::State& state, Output output) {
+    BM_Convert<dai::ros::SpatialDetectionConverter, dai::SpatialImgDetections, depthai_ros_msgs::msg::SpatialDetectionArray>(state, output);
+}
+
+void BM_TrackDetectionConverter(benchmark::State& state, Output output) {
+    BM_Convert<dai::ros::TrackDetectionConverter, dai::Tracklets, depthai_ros_msgs::msg::TrackDetection2DArray>(state, output);
+}
+
+void BM_TrackSpatialDetectionConverter(benchmark::State& state, Output output) {
+    BM_Convert<dai::ros::TrackSpatialDetectionConverter, dai::Tracklets, depthai_ros_msgs::msg::TrackDetection2DArray>(state, output);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ImgDetectionConverter, deque, Output::Deque);
+BENCHMARK_CAPTURE(BM_ImgDetectionConverter, reused_message, Output::ReusedMessage);
+BENCHMARK_CAPTURE(BM_ImgDetectionConverter, moved_message, Output::MovedMessage);
+BENCHMARK_CAPTURE(BM_SpatialDetectionConverter, deque, Output::Deque);
+BENCHMARK_CAPTURE(BM_SpatialDetectionConverter, reused_message, Output::ReusedMessage);
+BENCHMARK_CAPTURE(BM_SpatialDetectionConverter, moved_message, Output::MovedMessage);
+BENCHMARK_CAPTURE(BM_TrackDetectionConverter, deque, Output::Deque);
+BENCHMARK_CAPTURE(BM_TrackDetectionConverter, reused_message, Output::ReusedMessage);
+BENCHMARK_CAPTURE(BM_TrackDetectionConverter, moved_message, Output::MovedMessage);
+BENCHMARK_CAPTURE(BM_TrackSpatialDetectionConverter, deque, Output::Deque);
+BENCHMARK_CAPTURE(BM_TrackSpatialDetectionConverter, reused_message, Output::ReusedMessage);
+BENCHMARK_CAPTURE(BM_TrackSpatialDetectionConverter, moved_message, Output::MovedMessage);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,75 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "depthai_bridge/JpegDecoder.hpp"
+#include "opencv2/core.hpp"
+#include "opencv2/imgcodecs.hpp"
+
+namespace {
+
+// Noise on top of a gradient keeps the entropy coded part close to what a real scene produces.
+std::vector<uint8_t> encodeFrame(int width, int height, bool color) {
+    cv::Mat frame(height, width, color ? CV_8UC3 : CV_8UC1);
+    for(int row = 0; row < height; row++) {
+        auto* px = frame.ptr<uint8_t>(row);
+        for(int col = 0; col < width * frame.channels(); col++) {
+            px[col] = static_cast<uint8_t>((row + col) / 8);
+        }
+    }
+    cv::Mat noise(frame.size(), frame.type());
+    cv::randu(noise, 0, 32);
+    frame += noise;
+    std::vector<uint8_t> jpeg;
+    cv::imencode(".jpg", frame, jpeg, {cv::IMWRITE_JPEG_QUALITY, 50});
+    return jpeg;
+}
+
+// Previous path: imdecode into a fresh Mat, then cv_bridge copies it into the message.
+void BM_ImdecodeAndCopy(benchmark::State& state) {
+    const bool color = state.range(2) != 0;
+    const auto jpeg = encodeFrame(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), color);
+    std::vector<uint8_t> msgData;
+    for(auto _ : state) {
+        cv::Mat decoded = cv::imdecode(cv::Mat(jpeg), color ? cv::IMREAD_COLOR : cv::IMREAD_GRAYSCALE);
+        msgData.resize(decoded.total() * decoded.elemSize());
+        std::memcpy(msgData.data(), decoded.data, msgData.size());
+        benchmark::DoNotOptimize(msgData.data());
+    }
+}
+
+// state.range(3) is the decode scale.
+void BM_JpegDecoderDecodeInto(benchmark::State& state) {
+    const bool color = state.range(2) != 0;
+    const auto jpeg = encodeFrame(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), color);
+    dai::ros::JpegDecoder decoder(static_cast<int>(state.range(3)));
+    std::vector<uint8_t> msgData;
+    int width, height;
+    for(auto _ : state) {
+        decoder.decodeInto(jpeg, color ? cv::IMREAD_COLOR : cv::IMREAD_GRAYSCALE, color ? CV_8UC3 : CV_8UC1, msgData, width, height);
+        benchmark::DoNotOptimize(msgData.data());
+    }
+}
+
+}  // namespace
+
+// 1080p and 4K, color and mono.
+BENCHMARK(BM_ImdecodeAndCopy)
+    ->Args({1920, 1080, 1})
+    ->Args({1920, 1080, 0})
+    ->Args({3840, 2160, 1})
+    ->Args({3840, 2160, 0})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_JpegDecoderDecodeInto)
+    ->Args({1920, 1080, 1, 1})
+    ->Args({1920, 1080, 1, 2})
+    ->Args({1920, 1080, 1, 4})
+    ->Args({1920, 1080, 0, 1})
+    ->Args({3840, 2160, 1, 1})
+    ->Args({3840, 2160, 1, 2})
+    ->Args({3840, 2160, 1, 4})
+    ->Args({3840, 2160, 0, 1})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
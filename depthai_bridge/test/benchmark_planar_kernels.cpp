@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "depthai_bridge/PlanarKernels.hpp"
+
+namespace {
+
+// The "scalar" set is the byte loop planarToInterleaved and interleavedToPlanar ran before the SIMD kernels.
+void BM_Interleave(benchmark::State& state, dai::ros::PlanarKernelSet kernel) {
+    const size_t n = static_cast<size_t>(state.range(0)) * state.range(1);
+    std::vector<uint8_t> planes(n * 3, 7), out(n * 3);
+    for(auto _ : state) {
+        kernel.interleave(planes.data(), planes.data() + n, planes.data() + n * 2, out.data(), n);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 3);
+}
+
+void BM_Deinterleave(benchmark::State& state, dai::ros::PlanarKernelSet kernel) {
+    const size_t n = static_cast<size_t>(state.range(0)) * state.range(1);
+    std::vector<uint8_t> interleaved(n * 3, 7), planes(n * 3);
+    for(auto _ : state) {
+        kernel.deinterleave(interleaved.data(), planes.data(), planes.data() + n, planes.data() + n * 2, n);
+        benchmark::DoNotOptimize(planes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 3);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    for(const auto& kernel : dai::ros::supportedPlanarKernels()) {
+        // NN passthrough sizes and a 1080p topic-simulated input.
+        benchmark::RegisterBenchmark((std::string("BM_Interleave/") + kernel.name).c_str(), BM_Interleave, kernel)
+            ->Args({300, 300})
+            ->Args({416, 416})
+            ->Args({1920, 1080});
+        benchmark::RegisterBenchmark((std::string("BM_Deinterleave/") + kernel.name).c_str(), BM_Deinterleave, kernel)
+            ->Args({300, 300})
+            ->Args({416, 416})
+            ->Args({1920, 1080});
+    }
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Compares the consumer loop BridgePublisher::startPublisherThread used to run (tryGet in a tight loop) with the current one
+// (get with a timeout). DataOutputQueue is a thin wrapper over dai::LockingQueue, so the queue is used directly and no device is needed.
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "depthai/utility/LockingQueue.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Message {
+    Clock::time_point pushed;
+};
+
+enum class ConsumerMode { Polling, Blocking };
+
+int64_t threadCpuNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+class Consumer {
+   public:
+    Consumer(dai::LockingQueue<std::shared_ptr<Message>>& queue, ConsumerMode mode) : queue(queue), mode(mode) {
+        thread = std::thread([this]() { run(); });
+    }
+
+    ~Consumer() {
+        running = false;
+        thread.join();
+    }
+
+    int64_t getCpuNs() const {
+        return cpuNs;
+    }
+    int64_t getReceived() const {
+        return received;
+    }
+    int64_t getTotalLatencyNs() const {
+        return totalLatencyNs;
+    }
+
+   private:
+    void run() {
+        const auto queueTimeout = std::chrono::milliseconds(100);
+        while(running) {
+            std::shared_ptr<Message> msg;
+            bool got = mode == ConsumerMode::Polling ? queue.tryPop(msg) : queue.tryWaitAndPop(msg, queueTimeout);
+            if(got && msg) {
+                totalLatencyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - msg->pushed).count();
+                received++;
+            }
+            cpuNs = threadCpuNs();
+        }
+    }
+
+    dai::LockingQueue<std::shared_ptr<Message>>& queue;
+    ConsumerMode mode;
+    std::atomic<bool> running{true};
+    std::atomic<int64_t> cpuNs{0}, received{0}, totalLatencyNs{0};
+    std::thread thread;
+};
+
+// state.range(0) is the message period in microseconds, 0 keeps the queue idle.
+void runConsumer(benchmark::State& state, ConsumerMode mode) {
+    const auto period = std::chrono::microseconds(state.range(0));
+    const auto window = std::chrono::milliseconds(500);
+    dai::LockingQueue<std::shared_ptr<Message>> queue(30, false);
+    Consumer consumer(queue, mode);
+    int64_t cpuNs = 0, wallNs = 0;
+    for(auto _ : state) {
+        const int64_t cpuStart = consumer.getCpuNs();
+        const auto start = Clock::now();
+        auto next = start;
+        while(Clock::now() - start < window) {
+            if(period.count() == 0) {
+                std::this_thread::sleep_for(window);
+                break;
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+            queue.push(std::make_shared<Message>(Message{Clock::now()}));
+        }
+        cpuNs += consumer.getCpuNs() - cpuStart;
+        wallNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+    const int64_t received = consumer.getReceived();
+    state.counters["consumer_cpu_pct"] = wallNs > 0 ? 100.0 * cpuNs / wallNs : 0.0;
+    state.counters["latency_us"] = received > 0 ? consumer.getTotalLatencyNs() / 1000.0 / received : 0.0;
+    state.counters["messages"] = static_cast<double>(received);
+}
+
+void BM_PollingConsumer(benchmark::State& state) {
+    runConsumer(state, ConsumerMode::Polling);
+}
+
+void BM_BlockingConsumer(benchmark::State& state) {
+    runConsumer(state, ConsumerMode::Blocking);
+}
+
+}  // namespace
+
+// Idle stream, 30 fps camera and 400 Hz IMU.
+BENCHMARK(BM_PollingConsumer)->Arg(0)->Arg(33333)->Arg(2500)->Iterations(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BlockingConsumer)->Arg(0)->Arg(33333)->Arg(2500)->Iterations(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
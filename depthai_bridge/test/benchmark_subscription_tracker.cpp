@@ -0,0 +1,86 @@
+// Cost of the lazy publisher check on high rate topics: querying the ROS graph per message, as publishHelper did for non-image
+// messages, against reading the flag kept by SubscriptionTracker. The CPU column is the publishing thread's time per message.
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "depthai_bridge/SubscriptionTracker.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "sensor_msgs/msg/imu.hpp"
+#include "vision_msgs/msg/detection2_d_array.hpp"
+
+namespace {
+
+enum class Check { GraphQuery, TrackedFlag };
+
+template <typename MessageT>
+MessageT makeMessage() {
+    return MessageT();
+}
+
+template <>
+vision_msgs::msg::Detection2DArray makeMessage<vision_msgs::msg::Detection2DArray>() {
+    vision_msgs::msg::Detection2DArray msg;
+    msg.detections.resize(20);
+    for(auto& det : msg.detections) {
+        det.results.resize(1);
+    }
+    return msg;
+}
+
+// state.range(0) is the message rate in Hz, state.range(1) whether a subscriber is present.
+template <typename MessageT>
+void BM_LazyPublish(benchmark::State& state, Check check) {
+    const auto period = std::chrono::nanoseconds(1000000000 / state.range(0));
+    const bool withSubscriber = state.range(1) != 0;
+    auto node = std::make_shared<rclcpp::Node>("subscription_tracker_benchmark");
+    auto pub = node->create_publisher<MessageT>("~/lazy", 10);
+    typename rclcpp::Subscription<MessageT>::SharedPtr sub;
+    if(withSubscriber) {
+        sub = node->create_subscription<MessageT>("~/lazy", 10, [](const typename MessageT::SharedPtr) {});
+    }
+    auto tracker = dai::ros::SubscriptionTracker::getInstance(node->get_node_graph_interface());
+    auto subscribed = tracker->track(pub);
+    // Wait for discovery, so both checks see the same state from the first message on.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while(*subscribed != withSubscriber && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    const std::string topic = pub->get_topic_name();
+    const auto msg = makeMessage<MessageT>();
+    int64_t published = 0;
+    auto next = std::chrono::steady_clock::now();
+    for(auto _ : state) {
+        bool hasSubscribers = check == Check::GraphQuery ? node->count_subscribers(topic) > 0 : subscribed->load(std::memory_order_relaxed);
+        if(hasSubscribers) {
+            pub->publish(msg);
+            published++;
+        }
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+    state.counters["published"] = static_cast<double>(published);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_LazyPublish<sensor_msgs::msg::Imu>, imu_graph_query, Check::GraphQuery)->Args({400, 0})->Args({400, 1})->Iterations(1000);
+BENCHMARK_CAPTURE(BM_LazyPublish<sensor_msgs::msg::Imu>, imu_tracked_flag, Check::TrackedFlag)->Args({400, 0})->Args({400, 1})->Iterations(1000);
+BENCHMARK_CAPTURE(BM_LazyPublish<vision_msgs::msg::Detection2DArray>, detections_graph_query, Check::GraphQuery)
+    ->Args({200, 0})
+    ->Args({200, 1})
+    ->Iterations(1000);
+BENCHMARK_CAPTURE(BM_LazyPublish<vision_msgs::msg::Detection2DArray>, detections_tracked_flag, Check::TrackedFlag)
+    ->Args({200, 0})
+    ->Args({200, 1})
+    ->Iterations(1000);
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    rclcpp::init(argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    rclcpp::shutdown();
+    return 0;
+}
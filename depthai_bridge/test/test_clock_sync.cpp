@@ -0,0 +1,103 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+#include "depthai_bridge/ClockSync.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using dai::ros::ClockSync;
+
+// Synthetic clocks: ROS time runs 50 ppm fast against steady time and starts an hour ahead, sampled every 500 ms. The offset is
+// far from the one between the real clocks, so the first synthetic sample also re-anchors away from the sample the constructor takes.
+constexpr int64_t kStepNs = 500000000;
+constexpr double kDrift = 50e-6;
+constexpr int64_t kBaseSteadyNs = 1000LL * 1000000000LL;
+constexpr int64_t kBaseOffsetNs = 3600LL * 1000000000LL;
+constexpr int64_t kJumpNs = 2LL * 1000000000LL;
+
+int64_t steadyAt(int step) {
+    return kBaseSteadyNs + step * kStepNs;
+}
+
+int64_t rosAt(int step, int64_t jumpNs = 0) {
+    return steadyAt(step) + kBaseOffsetNs + std::llround(kDrift * static_cast<double>(step * kStepNs)) + jumpNs;
+}
+
+ClockSync::SteadyTimePoint toSteady(int64_t ns) {
+    return ClockSync::SteadyTimePoint(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(ns)));
+}
+
+void feed(ClockSync& sync, int step, int64_t jumpNs = 0) {
+    sync.addSample(toSteady(steadyAt(step)), rclcpp::Time(rosAt(step, jumpNs)));
+}
+
+int64_t rosTimeAt(const ClockSync& sync, int step) {
+    return sync.toRosTime(toSteady(steadyAt(step))).nanoseconds();
+}
+
+TEST(ClockSync, FirstSampleReanchors) {
+    ClockSync sync(20);
+    feed(sync, 0);
+    // A single sample has no slope, the mapping is exactly its offset.
+    EXPECT_EQ(sync.getDrift(), 0.0);
+    EXPECT_EQ(rosTimeAt(sync, 0), rosAt(0));
+}
+
+TEST(ClockSync, FitsDrift) {
+    ClockSync sync(20);
+    for(int step = 0; step < 20; step++) {
+        feed(sync, step);
+    }
+    EXPECT_NEAR(sync.getDrift(), kDrift, 1e-9);
+    // Extrapolated 10 s past the last sample, a fit without drift would be off by 500 us.
+    EXPECT_NEAR(static_cast<double>(rosTimeAt(sync, 40)), static_cast<double>(rosAt(40)), 100.0);
+}
+
+TEST(ClockSync, FitUsesOnlyWindow) {
+    ClockSync sync(5);
+    // Samples without drift first, then drifting ones. Once they fill the window, the old samples must not bend the fit.
+    for(int step = 0; step < 10; step++) {
+        sync.addSample(toSteady(steadyAt(step)), rclcpp::Time(steadyAt(step) + kBaseOffsetNs));
+    }
+    EXPECT_NEAR(sync.getDrift(), 0.0, 1e-9);
+    for(int step = 10; step < 15; step++) {
+        // Continues from the last offset so no sample is far enough off the fit to count as a jump.
+        int64_t driftNs = std::llround(kDrift * static_cast<double>((step - 9) * kStepNs));
+        sync.addSample(toSteady(steadyAt(step)), rclcpp::Time(steadyAt(step) + kBaseOffsetNs + driftNs));
+    }
+    EXPECT_NEAR(sync.getDrift(), kDrift, 1e-9);
+}
+
+TEST(ClockSync, ReanchorsOnJump) {
+    ClockSync sync(20);
+    for(int step = 0; step < 10; step++) {
+        feed(sync, step);
+    }
+    ASSERT_NEAR(sync.getDrift(), kDrift, 1e-9);
+
+    // ROS time steps forward, the window restarts from the jumped sample.
+    feed(sync, 10, kJumpNs);
+    EXPECT_EQ(sync.getDrift(), 0.0);
+    EXPECT_EQ(rosTimeAt(sync, 10), rosAt(10, kJumpNs));
+
+    for(int step = 11; step < 20; step++) {
+        feed(sync, step, kJumpNs);
+    }
+    EXPECT_NEAR(sync.getDrift(), kDrift, 1e-9);
+    EXPECT_NEAR(static_cast<double>(rosTimeAt(sync, 30)), static_cast<double>(rosAt(30, kJumpNs)), 100.0);
+}
+
+TEST(ClockSync, KeepsWindowBelowJumpThreshold) {
+    ClockSync sync(20);
+    for(int step = 0; step < 10; step++) {
+        feed(sync, step);
+    }
+    // 200 us of noise is below the 1 ms jump threshold, the sample joins the fit instead of restarting the window.
+    feed(sync, 10, 200000);
+    EXPECT_GT(sync.getDrift(), 0.0);
+    EXPECT_NEAR(static_cast<double>(rosTimeAt(sync, 10)), static_cast<double>(rosAt(10)), 200000.0);
+}
+
+}  // namespace
@@ -0,0 +1,157 @@
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai_bridge/DisparityConverter.hpp"
+#include "depthai_bridge/DisparityKernels.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using dai::ros::DisparityKernelSet;
+
+// Pixel counts around the 8 and 16 pixel SIMD blocks, so every kernel also runs its scalar tail.
+const std::vector<size_t> pixelCounts = {0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 641 * 3, 1280 * 800 + 5};
+
+// Per pixel loops of the converter before the kernels, the reference every kernel has to match bit for bit.
+std::vector<float> referenceRaw8(const uint8_t* src, size_t n) {
+    std::vector<float> out(n);
+    for(size_t i = 0; i < n; i++) out[i] = static_cast<float>(src[i]);
+    return out;
+}
+
+std::vector<float> referenceRaw16(const uint8_t* src, size_t n, int fractionalBits) {
+    const float scale = static_cast<float>(1.0 / static_cast<double>(1 << fractionalBits));
+    std::vector<float> out(n);
+    for(size_t i = 0; i < n; i++) {
+        int16_t disp;
+        std::memcpy(&disp, src + i * sizeof(int16_t), sizeof(disp));
+        out[i] = static_cast<float>(disp) * scale;
+    }
+    return out;
+}
+
+std::vector<uint8_t> randomBytes(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(size);
+    for(auto& b : bytes) b = static_cast<uint8_t>(dist(rng));
+    return bytes;
+}
+
+bool sameBits(const std::vector<float>& expected, const float* actual) {
+    return expected.empty() || std::memcmp(expected.data(), actual, expected.size() * sizeof(float)) == 0;
+}
+
+class DisparityKernelsTest : public ::testing::TestWithParam<DisparityKernelSet> {};
+
+TEST_P(DisparityKernelsTest, ToFloatMatchesReference) {
+    const auto kernel = GetParam();
+    for(size_t n : pixelCounts) {
+        // One byte offset keeps the input unaligned, the kernels may only use unaligned loads.
+        auto input = randomBytes(n + 1, static_cast<uint32_t>(n));
+        const uint8_t* src = input.data() + 1;
+        auto expected = referenceRaw8(src, n);
+        // Guard values after the output catch stores past the end.
+        std::vector<float> out(n + 32, -1.0f);
+        kernel.toFloat(src, out.data(), n);
+        ASSERT_TRUE(sameBits(expected, out.data())) << kernel.name << " with " << n << " pixels";
+        for(size_t i = n; i < out.size(); i++) {
+            ASSERT_EQ(out[i], -1.0f) << kernel.name << " wrote past the end with " << n << " pixels";
+        }
+    }
+}
+
+TEST_P(DisparityKernelsTest, SubpixelToFloatMatchesReference) {
+    const auto kernel = GetParam();
+    for(int bits = 3; bits <= 5; bits++) {
+        const float scale = static_cast<float>(1.0 / static_cast<double>(1 << bits));
+        for(size_t n : pixelCounts) {
+            // Odd byte offset, RAW16 frames are byte buffers and give no 2 byte alignment guarantee.
+            auto input = randomBytes(n * sizeof(int16_t) + 1, static_cast<uint32_t>(n) + bits);
+            const uint8_t* src = input.data() + 1;
+            auto expected = referenceRaw16(src, n, bits);
+            std::vector<float> out(n + 32, -1.0f);
+            kernel.subpixelToFloat(reinterpret_cast<const int16_t*>(src), out.data(), n, scale);
+            ASSERT_TRUE(sameBits(expected, out.data())) << kernel.name << " with " << bits << " bits and " << n << " pixels";
+            for(size_t i = n; i < out.size(); i++) {
+                ASSERT_EQ(out[i], -1.0f) << kernel.name << " wrote past the end with " << n << " pixels";
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllKernels,
+                         DisparityKernelsTest,
+                         ::testing::ValuesIn(dai::ros::supportedDisparityKernels()),
+                         [](const ::testing::TestParamInfo<DisparityKernelSet>& info) {
+                             // gtest names may not contain the dot of "sse4.1".
+                             std::string name(info.param.name);
+                             for(auto& c : name) {
+                                 if(c == '.') c = '_';
+                             }
+                             return name;
+                         });
+
+TEST(DisparityKernels, SelectsFastestSupportedSet) {
+    auto sets = dai::ros::supportedDisparityKernels();
+    ASSERT_FALSE(sets.empty());
+    EXPECT_STREQ(sets.front().name, "scalar");
+    EXPECT_STREQ(sets.back().name, dai::ros::disparityKernelName());
+}
+
+std::shared_ptr<dai::ImgFrame> makeFrame(dai::RawImgFrame::Type type, int width, int height, uint32_t seed) {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    frame->setWidth(width);
+    frame->setHeight(height);
+    frame->setType(type);
+    const size_t bpp = type == dai::RawImgFrame::Type::RAW8 ? 1 : sizeof(int16_t);
+    frame->setData(randomBytes(static_cast<size_t>(width) * height * bpp, seed));
+    return frame;
+}
+
+TEST(DisparityConverter, Raw8MatchesReference) {
+    dai::ros::DisparityConverter converter("disparity", 880, 7.5, 20, 2000);
+    auto frame = makeFrame(dai::RawImgFrame::Type::RAW8, 641, 401, 1);
+    std::deque<stereo_msgs::msg::DisparityImage> msgs;
+    converter.toRosMsg(frame, msgs);
+    ASSERT_EQ(msgs.size(), 1u);
+    const auto& msg = msgs.front();
+    EXPECT_EQ(msg.delta_d, 1.0f);
+    EXPECT_EQ(msg.image.width, 641u);
+    EXPECT_EQ(msg.image.height, 401u);
+    EXPECT_EQ(msg.image.step, 641u * sizeof(float));
+    ASSERT_EQ(msg.image.data.size(), 641u * 401u * sizeof(float));
+    auto expected = referenceRaw8(frame->getData().data(), 641 * 401);
+    EXPECT_TRUE(sameBits(expected, reinterpret_cast<const float*>(msg.image.data.data())));
+}
+
+TEST(DisparityConverter, Raw16FollowsFractionalBits) {
+    dai::ros::DisparityConverter converter("disparity", 880, 7.5, 20, 2000);
+    auto frame = makeFrame(dai::RawImgFrame::Type::RAW16, 641, 401, 2);
+    for(int bits = 3; bits <= 5; bits++) {
+        converter.setSubpixelFractionalBits(bits);
+        std::deque<stereo_msgs::msg::DisparityImage> msgs;
+        converter.toRosMsg(frame, msgs);
+        ASSERT_EQ(msgs.size(), 1u);
+        const auto& msg = msgs.front();
+        EXPECT_EQ(msg.delta_d, 1.0f / static_cast<float>(1 << bits));
+        ASSERT_EQ(msg.image.data.size(), 641u * 401u * sizeof(float));
+        auto expected = referenceRaw16(frame->getData().data(), 641 * 401, bits);
+        EXPECT_TRUE(sameBits(expected, reinterpret_cast<const float*>(msg.image.data.data()))) << bits << " bits";
+    }
+}
+
+TEST(DisparityConverter, RejectsInvalidFractionalBits) {
+    dai::ros::DisparityConverter converter("disparity", 880, 7.5, 20, 2000);
+    EXPECT_THROW(converter.setSubpixelFractionalBits(-1), std::runtime_error);
+    EXPECT_THROW(converter.setSubpixelFractionalBits(6), std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,226 @@
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "depthai/pipeline/datatype/IMUData.hpp"
+#include "depthai/pipeline/datatype/ImgFrame.hpp"
+#include "depthai_bridge/ImuConverter.hpp"
+#include "gtest/gtest.h"
+#include "tf2/LinearMath/Quaternion.h"
+
+namespace {
+
+constexpr int64_t kAccelPeriodNs = 4000000;
+constexpr int64_t kGyroOffsetNs = 1000000;
+
+dai::Timestamp toTimestamp(int64_t ns) {
+    dai::Timestamp ts;
+    ts.sec = ns / 1000000000;
+    ts.nsec = ns % 1000000000;
+    return ts;
+}
+
+/**
+ * Synthetic device packets. Accelerometer and gyroscope report at the same rate with the gyroscope 1/4 of a period later, so
+ * accelerometer values interpolated at gyroscope time are known: accel.y ramps by one per report and gyro.x holds the value
+ * accel.y must be interpolated to. The other axes carry the id of the converter, to spot samples leaking between converters.
+ */
+std::shared_ptr<dai::IMUData> makePackets(int converterId, int64_t baseNs, int first, int count) {
+    auto data = std::make_shared<dai::IMUData>();
+    for(int i = first; i < first + count; i++) {
+        dai::IMUPacket packet;
+        packet.acceleroMeter.sequence = i;
+        packet.acceleroMeter.timestamp = toTimestamp(baseNs + i * kAccelPeriodNs);
+        packet.acceleroMeter.tsDevice = packet.acceleroMeter.timestamp;
+        packet.acceleroMeter.x = static_cast<float>(converterId);
+        packet.acceleroMeter.y = static_cast<float>(i);
+        packet.acceleroMeter.z = static_cast<float>(converterId);
+        packet.gyroscope.sequence = i;
+        packet.gyroscope.timestamp = toTimestamp(baseNs + i * kAccelPeriodNs + kGyroOffsetNs);
+        packet.gyroscope.tsDevice = packet.gyroscope.timestamp;
+        packet.gyroscope.x = static_cast<float>(i + 0.25);
+        packet.gyroscope.y = static_cast<float>(converterId);
+        packet.gyroscope.z = static_cast<float>(converterId);
+        data->packets.push_back(packet);
+    }
+    return data;
+}
+
+int64_t steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+constexpr double kYawRate = 1.0;
+
+// Device at rest spinning about z at kYawRate, reports kAccelPeriodNs apart starting at baseNs.
+std::shared_ptr<dai::IMUData> makeYawPackets(int64_t baseNs, int first, int count) {
+    auto data = std::make_shared<dai::IMUData>();
+    for(int i = first; i < first + count; i++) {
+        dai::IMUPacket packet;
+        packet.acceleroMeter.sequence = i;
+        packet.acceleroMeter.timestamp = toTimestamp(baseNs + i * kAccelPeriodNs);
+        packet.gyroscope.sequence = i;
+        packet.gyroscope.timestamp = toTimestamp(baseNs + i * kAccelPeriodNs + kGyroOffsetNs);
+        packet.gyroscope.z = static_cast<float>(kYawRate);
+        data->packets.push_back(packet);
+    }
+    return data;
+}
+
+std::shared_ptr<dai::ImgFrame> makeFrame(int64_t stampNs, int64_t sequenceNum) {
+    auto frame = std::make_shared<dai::ImgFrame>();
+    frame->setTimestamp(
+        std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(stampNs))));
+    frame->setSequenceNum(sequenceNum);
+    return frame;
+}
+
+void expectYaw(const depthai_ros_msgs::msg::ImuFrameBundle& bundle, double dt) {
+    ASSERT_TRUE(bundle.has_preintegration);
+    EXPECT_NEAR(bundle.dt, dt, 1e-6);
+    tf2::Quaternion expected(tf2::Vector3(0.0, 0.0, 1.0), kYawRate * dt);
+    tf2::Quaternion actual(bundle.delta_rotation.x, bundle.delta_rotation.y, bundle.delta_rotation.z, bundle.delta_rotation.w);
+    EXPECT_NEAR(actual.angleShortestPath(expected), 0.0, 1e-5);
+    EXPECT_NEAR(bundle.delta_velocity.x, 0.0, 1e-9);
+    EXPECT_NEAR(bundle.delta_position.x, 0.0, 1e-9);
+}
+
+TEST(ImuConverter, ConcurrentConvertersKeepTheirOwnHistory) {
+    constexpr int kConverters = 3;
+    constexpr int kPackets = 2000;
+    constexpr int kBatch = 5;
+    const int64_t baseNs = steadyNowNs();
+
+    std::vector<std::unique_ptr<dai::ros::ImuConverter>> converters;
+    std::vector<std::deque<sensor_msgs::msg::Imu>> outputs(kConverters);
+    for(int id = 0; id < kConverters; id++) {
+        converters.push_back(std::make_unique<dai::ros::ImuConverter>("imu_" + std::to_string(id)));
+        converters.back()->setSensorRates(250, 250);
+    }
+    std::vector<std::thread> threads;
+    for(int id = 0; id < kConverters; id++) {
+        threads.emplace_back([&, id]() {
+            for(int first = 0; first < kPackets; first += kBatch) {
+                converters[id]->toRosMsg(makePackets(id, baseNs, first, kBatch), outputs[id]);
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+
+    for(int id = 0; id < kConverters; id++) {
+        const auto& msgs = outputs[id];
+        // The newest gyroscope sample waits for the next accelerometer report.
+        EXPECT_GE(msgs.size(), static_cast<size_t>(kPackets - 2)) << "converter " << id;
+        EXPECT_LE(msgs.size(), static_cast<size_t>(kPackets)) << "converter " << id;
+        int64_t lastStampNs = 0;
+        for(const auto& msg : msgs) {
+            EXPECT_EQ(msg.header.frame_id, "imu_" + std::to_string(id));
+            ASSERT_FLOAT_EQ(msg.linear_acceleration.x, id);
+            ASSERT_FLOAT_EQ(msg.linear_acceleration.z, id);
+            ASSERT_FLOAT_EQ(msg.angular_velocity.y, id);
+            ASSERT_NEAR(msg.linear_acceleration.y, msg.angular_velocity.x, 1e-3);
+            int64_t stampNs = rclcpp::Time(msg.header.stamp).nanoseconds();
+            ASSERT_GT(stampNs, lastStampNs);
+            lastStampNs = stampNs;
+        }
+    }
+}
+
+TEST(ImuConverter, ConcurrentBatchConversion) {
+    constexpr int kConverters = 3;
+    constexpr int kPackets = 1000;
+    const int64_t baseNs = steadyNowNs();
+
+    std::vector<std::unique_ptr<dai::ros::ImuConverter>> converters;
+    std::vector<size_t> counts(kConverters, 0);
+    for(int id = 0; id < kConverters; id++) {
+        converters.push_back(std::make_unique<dai::ros::ImuConverter>("imu_" + std::to_string(id), dai::ros::ImuSyncMethod::LINEAR_INTERPOLATE_GYRO));
+    }
+    std::vector<std::thread> threads;
+    for(int id = 0; id < kConverters; id++) {
+        threads.emplace_back([&, id]() {
+            depthai_ros_msgs::msg::ImuBatch batch;
+            for(int first = 0; first < kPackets; first += 10) {
+                converters[id]->toRosBatchMsg(makePackets(id, baseNs, first, 10), batch);
+                for(const auto& msg : batch.imu) {
+                    ASSERT_FLOAT_EQ(msg.linear_acceleration.x, id);
+                    ASSERT_FLOAT_EQ(msg.angular_velocity.y, id);
+                    // Gyroscope interpolated at accelerometer time lands on the accelerometer ramp.
+                    ASSERT_NEAR(msg.angular_velocity.x, msg.linear_acceleration.y, 1e-3);
+                }
+                counts[id] += batch.imu.size();
+            }
+        });
+    }
+    for(auto& thread : threads) {
+        thread.join();
+    }
+    for(int id = 0; id < kConverters; id++) {
+        EXPECT_GE(counts[id], static_cast<size_t>(kPackets - 2)) << "converter " << id;
+    }
+}
+
+TEST(ImuConverter, PreintegratesConstantRotation) {
+    constexpr int64_t kFramePeriodNs = 10 * kAccelPeriodNs;
+    const int64_t baseNs = steadyNowNs();
+    dai::ros::ImuConverter converter("imu");
+    converter.setFrameBundling(true, true);
+    std::deque<sensor_msgs::msg::Imu> samples;
+    converter.toRosMsg(makeYawPackets(baseNs, 0, 40), samples);
+
+    depthai_ros_msgs::msg::ImuFrameBundle bundle;
+    converter.toRosFrameBundle(makeFrame(baseNs + kFramePeriodNs, 1), bundle);
+    converter.toRosFrameBundle(makeFrame(baseNs + 2 * kFramePeriodNs, 2), bundle);
+    EXPECT_EQ(bundle.frame_sequence_num, 2);
+    EXPECT_EQ(bundle.imu.size(), 10u);
+    expectYaw(bundle, kFramePeriodNs * 1e-9);
+    converter.toRosFrameBundle(makeFrame(baseNs + 3 * kFramePeriodNs, 3), bundle);
+    expectYaw(bundle, kFramePeriodNs * 1e-9);
+}
+
+TEST(ImuConverter, FrameBundleWaitsForLaterSample) {
+    constexpr int64_t kFrameNs = 10 * kAccelPeriodNs;
+    const int64_t baseNs = steadyNowNs();
+    dai::ros::ImuConverter converter("imu");
+    converter.setFrameBundling(true, true, std::chrono::seconds(5));
+    std::deque<sensor_msgs::msg::Imu> samples;
+    converter.toRosMsg(makeYawPackets(baseNs, 0, 5), samples);
+
+    // The rest of the interval is converted on another thread while the frame is already waiting.
+    std::thread imuThread([&]() {
+        std::deque<sensor_msgs::msg::Imu> late;
+        for(int first = 5; first < 20; first += 5) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            converter.toRosMsg(makeYawPackets(baseNs, first, 5), late);
+        }
+    });
+    depthai_ros_msgs::msg::ImuFrameBundle bundle;
+    converter.toRosFrameBundle(makeFrame(baseNs + kFrameNs, 1), bundle);
+    imuThread.join();
+    ASSERT_EQ(bundle.imu.size(), 10u);
+    EXPECT_EQ(rclcpp::Time(bundle.imu.back().header.stamp).nanoseconds() - rclcpp::Time(bundle.imu.front().header.stamp).nanoseconds(), 9 * kAccelPeriodNs);
+}
+
+TEST(ImuConverter, LateSamplesOnlyCountInsideTheirBundle) {
+    constexpr int64_t kFramePeriodNs = 10 * kAccelPeriodNs;
+    const int64_t baseNs = steadyNowNs();
+    dai::ros::ImuConverter converter("imu");
+    converter.setFrameBundling(true, true, std::chrono::milliseconds(1));
+    std::deque<sensor_msgs::msg::Imu> samples;
+    converter.toRosMsg(makeYawPackets(baseNs, 0, 8), samples);
+    depthai_ros_msgs::msg::ImuFrameBundle bundle;
+    converter.toRosFrameBundle(makeFrame(baseNs + kFramePeriodNs, 1), bundle);
+
+    // The first frame timed out before the samples just before it were converted, they end up in the second bundle.
+    converter.toRosMsg(makeYawPackets(baseNs, 8, 24), samples);
+    converter.toRosFrameBundle(makeFrame(baseNs + 2 * kFramePeriodNs, 2), bundle);
+    EXPECT_LT(rclcpp::Time(bundle.imu.front().header.stamp).nanoseconds(), rclcpp::Time(bundle.header.stamp).nanoseconds() - kFramePeriodNs);
+    expectYaw(bundle, kFramePeriodNs * 1e-9);
+}
+
+}  // namespace
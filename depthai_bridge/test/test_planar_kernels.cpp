@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "depthai_bridge/PlanarKernels.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using dai::ros::PlanarKernelSet;
+
+// Pixel counts around the 16 and 32 pixel SIMD blocks, so every kernel also runs its scalar tail.
+const std::vector<size_t> pixelCounts = {0, 1, 2, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65, 95, 97, 641 * 3, 1280 * 800 + 7};
+
+std::vector<uint8_t> randomBytes(size_t size, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(size);
+    for(auto& b : bytes) b = static_cast<uint8_t>(dist(rng));
+    return bytes;
+}
+
+class PlanarKernelsTest : public ::testing::TestWithParam<PlanarKernelSet> {};
+
+TEST_P(PlanarKernelsTest, InterleaveMatchesReference) {
+    const auto kernel = GetParam();
+    for(size_t n : pixelCounts) {
+        // One byte offset keeps the buffers unaligned, the kernels may only use unaligned loads and stores.
+        auto planes = randomBytes(n * 3 + 1, static_cast<uint32_t>(n));
+        const uint8_t* p0 = planes.data() + 1;
+        const uint8_t* p1 = p0 + n;
+        const uint8_t* p2 = p1 + n;
+        std::vector<uint8_t> expected(n * 3);
+        for(size_t i = 0; i < n; i++) {
+            expected[i * 3 + 0] = p0[i];
+            expected[i * 3 + 1] = p1[i];
+            expected[i * 3 + 2] = p2[i];
+        }
+        // Guard bytes after the output catch stores past the end.
+        std::vector<uint8_t> out(n * 3 + 1 + 64, 0xAB);
+        kernel.interleave(p0, p1, p2, out.data() + 1, n);
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin() + 1)) << kernel.name << " with " << n << " pixels";
+        for(size_t i = n * 3 + 1; i < out.size(); i++) {
+            ASSERT_EQ(out[i], 0xAB) << kernel.name << " wrote past the end with " << n << " pixels";
+        }
+        ASSERT_EQ(out[0], 0xAB) << kernel.name << " wrote before the start with " << n << " pixels";
+    }
+}
+
+TEST_P(PlanarKernelsTest, DeinterleaveMatchesReference) {
+    const auto kernel = GetParam();
+    for(size_t n : pixelCounts) {
+        auto interleaved = randomBytes(n * 3 + 1, static_cast<uint32_t>(n) + 1);
+        const uint8_t* src = interleaved.data() + 1;
+        std::vector<uint8_t> expected0(n), expected1(n), expected2(n);
+        for(size_t i = 0; i < n; i++) {
+            expected0[i] = src[i * 3 + 0];
+            expected1[i] = src[i * 3 + 1];
+            expected2[i] = src[i * 3 + 2];
+        }
+        std::vector<uint8_t> expected(expected0);
+        expected.insert(expected.end(), expected1.begin(), expected1.end());
+        expected.insert(expected.end(), expected2.begin(), expected2.end());
+        std::vector<uint8_t> out(n * 3 + 1 + 64, 0xAB);
+        uint8_t* p0 = out.data() + 1;
+        kernel.deinterleave(src, p0, p0 + n, p0 + n * 2, n);
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin() + 1)) << kernel.name << " with " << n << " pixels";
+        for(size_t i = n * 3 + 1; i < out.size(); i++) {
+            ASSERT_EQ(out[i], 0xAB) << kernel.name << " wrote past the end with " << n << " pixels";
+        }
+        ASSERT_EQ(out[0], 0xAB) << kernel.name << " wrote before the start with " << n << " pixels";
+    }
+}
+
+TEST_P(PlanarKernelsTest, RoundTrip) {
+    const auto kernel = GetParam();
+    const size_t n = 641 * 401;
+    auto planes = randomBytes(n * 3, 42);
+    std::vector<uint8_t> interleaved(n * 3), back(n * 3);
+    kernel.interleave(planes.data(), planes.data() + n, planes.data() + n * 2, interleaved.data(), n);
+    kernel.deinterleave(interleaved.data(), back.data(), back.data() + n, back.data() + n * 2, n);
+    EXPECT_EQ(planes, back) << kernel.name;
+}
+
+INSTANTIATE_TEST_SUITE_P(AllKernels,
+                         PlanarKernelsTest,
+                         ::testing::ValuesIn(dai::ros::supportedPlanarKernels()),
+                         [](const ::testing::TestParamInfo<PlanarKernelSet>& info) { return std::string(info.param.name); });
+
+TEST(PlanarKernels, SelectsFastestSupportedSet) {
+    auto sets = dai::ros::supportedPlanarKernels();
+    ASSERT_FALSE(sets.empty());
+    EXPECT_STREQ(sets.front().name, "scalar");
+    EXPECT_STREQ(sets.back().name, dai::ros::planarKernelName());
+}
+
+}  // namespace
@@ -0,0 +1,98 @@
+#include <stdexcept>
+
+#include "depthai_bridge/RingBuffer.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using dai::ros::RingBuffer;
+
+TEST(RingBuffer, KeepsFifoOrderAcrossWrapAround) {
+    RingBuffer<int> buffer(4);
+    int next = 0, expected = 0;
+    for(int round = 0; round < 10; round++) {
+        buffer.push_back(next++);
+        buffer.push_back(next++);
+        buffer.push_back(next++);
+        ASSERT_EQ(buffer.size(), 3u);
+        for(size_t i = 0; i < buffer.size(); i++) {
+            EXPECT_EQ(buffer.at(i), expected + static_cast<int>(i));
+        }
+        EXPECT_EQ(buffer.front(), expected);
+        EXPECT_EQ(buffer.back(), next - 1);
+        while(!buffer.empty()) {
+            EXPECT_EQ(buffer.front(), expected++);
+            buffer.pop_front();
+        }
+    }
+    EXPECT_EQ(buffer.getDroppedCount(), 0u);
+}
+
+TEST(RingBuffer, OverwritesOldestWhenFull) {
+    RingBuffer<int> buffer(3);
+    for(int i = 0; i < 10; i++) {
+        buffer.push_back(i);
+    }
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(buffer.capacity(), 3u);
+    EXPECT_EQ(buffer.getDroppedCount(), 7u);
+    EXPECT_EQ(buffer.at(0), 7);
+    EXPECT_EQ(buffer.at(1), 8);
+    EXPECT_EQ(buffer.at(2), 9);
+}
+
+TEST(RingBuffer, SetCapacityKeepsNewest) {
+    RingBuffer<int> buffer(8);
+    for(int i = 0; i < 11; i++) {
+        buffer.push_back(i);
+    }
+    buffer.setCapacity(4);
+    ASSERT_EQ(buffer.size(), 4u);
+    EXPECT_EQ(buffer.front(), 7);
+    EXPECT_EQ(buffer.back(), 10);
+    buffer.setCapacity(16);
+    ASSERT_EQ(buffer.size(), 4u);
+    EXPECT_EQ(buffer.front(), 7);
+    buffer.push_back(11);
+    EXPECT_EQ(buffer.back(), 11);
+}
+
+TEST(RingBuffer, ResizeIsBoundedByCapacity) {
+    RingBuffer<int> buffer(4);
+    buffer.push_back(1);
+    buffer.resize(3);
+    ASSERT_EQ(buffer.size(), 3u);
+    EXPECT_EQ(buffer.at(0), 1);
+    EXPECT_EQ(buffer.at(1), 0);
+    buffer.resize(100);
+    EXPECT_EQ(buffer.size(), 4u);
+    buffer.resize(1);
+    ASSERT_EQ(buffer.size(), 1u);
+    EXPECT_EQ(buffer.front(), 1);
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(RingBuffer, DoesNotReallocateWhilePushing) {
+    RingBuffer<int> buffer(16);
+    // Buffer is empty, so this is the first slot of the storage allocated by the constructor.
+    const int* storage = &buffer.at(0);
+    for(int i = 0; i < 1000; i++) {
+        buffer.push_back(i);
+        if(i % 3 == 0) {
+            buffer.pop_front();
+        }
+    }
+    EXPECT_EQ(buffer.capacity(), 16u);
+    for(size_t i = 0; i < buffer.size(); i++) {
+        EXPECT_GE(&buffer.at(i), storage);
+        EXPECT_LT(&buffer.at(i), storage + 16);
+    }
+}
+
+TEST(RingBuffer, ThrowsWithoutCapacity) {
+    RingBuffer<int> buffer;
+    EXPECT_THROW(buffer.push_back(1), std::runtime_error);
+}
+
+}  // namespace
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "depthai_bridge/VideoDecoder.hpp"
+#include "gtest/gtest.h"
+#include "opencv2/core/mat.hpp"
+
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavutil/opt.h>
+}
+#endif
+
+namespace {
+
+using dai::ros::VideoDecoder;
+
+TEST(VideoDecoder, DetectsH264Keyframes) {
+    // SPS, PPS and IDR slice as sent with every device keyframe.
+    const std::vector<uint8_t> idr = {0, 0, 0, 1, 0x67, 0x42, 0, 0, 0, 1, 0x68, 0xCE, 0, 0, 1, 0x65, 0x88, 0x84};
+    const std::vector<uint8_t> nonIdr = {0, 0, 0, 1, 0x41, 0x9A, 0x02};
+    const std::vector<uint8_t> seiOnly = {0, 0, 0, 1, 0x06, 0x05, 0x01};
+    EXPECT_TRUE(VideoDecoder::isKeyframe(idr.data(), idr.size(), VideoDecoder::Codec::H264));
+    EXPECT_FALSE(VideoDecoder::isKeyframe(nonIdr.data(), nonIdr.size(), VideoDecoder::Codec::H264));
+    EXPECT_FALSE(VideoDecoder::isKeyframe(seiOnly.data(), seiOnly.size(), VideoDecoder::Codec::H264));
+    EXPECT_FALSE(VideoDecoder::isKeyframe(nullptr, 0, VideoDecoder::Codec::H264));
+}
+
+TEST(VideoDecoder, DetectsH265Keyframes) {
+    // VPS, SPS, PPS and IDR_W_RADL, then a TRAIL_R picture.
+    const std::vector<uint8_t> idr = {0, 0, 0, 1, 0x40, 0x01, 0, 0, 0, 1, 0x42, 0x01, 0, 0, 0, 1, 0x44, 0x01, 0, 0, 1, 0x26, 0x01, 0xAF};
+    const std::vector<uint8_t> cra = {0, 0, 0, 1, 0x2A, 0x01, 0xAF};
+    const std::vector<uint8_t> trail = {0, 0, 0, 1, 0x02, 0x01, 0xD0};
+    EXPECT_TRUE(VideoDecoder::isKeyframe(idr.data(), idr.size(), VideoDecoder::Codec::H265));
+    EXPECT_TRUE(VideoDecoder::isKeyframe(cra.data(), cra.size(), VideoDecoder::Codec::H265));
+    EXPECT_FALSE(VideoDecoder::isKeyframe(trail.data(), trail.size(), VideoDecoder::Codec::H265));
+}
+
+#ifdef DEPTHAI_BRIDGE_HAS_LIBAV
+
+constexpr int kWidth = 320;
+constexpr int kHeight = 240;
+constexpr int kGopSize = 10;
+constexpr int kFrames = 30;
+
+uint8_t lumaAt(int frameIdx) {
+    return static_cast<uint8_t>(40 + frameIdx * 5);
+}
+
+/**
+ * Records a short stream the way the device sends it: Annex-B access units, no B-frames, a keyframe every kGopSize frames.
+ * Every frame is flat grey with a different level, so decoded frames can be matched to their source.
+ */
+bool recordPackets(AVCodecID codecId, std::vector<std::vector<uint8_t>>& packets) {
+    const AVCodec* codec = avcodec_find_encoder(codecId);
+    if(codec == nullptr) {
+        return false;
+    }
+    AVCodecContext* ctx = avcodec_alloc_context3(codec);
+    ctx->width = kWidth;
+    ctx->height = kHeight;
+    ctx->time_base = {1, 30};
+    ctx->framerate = {30, 1};
+    ctx->pix_fmt = AV_PIX_FMT_YUV420P;
+    ctx->gop_size = kGopSize;
+    ctx->max_b_frames = 0;
+    av_opt_set(ctx->priv_data, "tune", "zerolatency", 0);
+    av_opt_set(ctx->priv_data, "forced-idr", "1", 0);
+    if(avcodec_open2(ctx, codec, nullptr) < 0) {
+        avcodec_free_context(&ctx);
+        return false;
+    }
+    AVFrame* frame = av_frame_alloc();
+    frame->width = kWidth;
+    frame->height = kHeight;
+    frame->format = AV_PIX_FMT_YUV420P;
+    av_frame_get_buffer(frame, 0);
+    AVPacket* packet = av_packet_alloc();
+    auto drain = [&]() {
+        while(avcodec_receive_packet(ctx, packet) == 0) {
+            packets.emplace_back(packet->data, packet->data + packet->size);
+            av_packet_unref(packet);
+        }
+    };
+    for(int i = 0; i < kFrames; i++) {
+        av_frame_make_writable(frame);
+        for(int row = 0; row < kHeight; row++) {
+            std::fill_n(frame->data[0] + row * frame->linesize[0], kWidth, lumaAt(i));
+        }
+        for(int plane = 1; plane < 3; plane++) {
+            for(int row = 0; row < kHeight / 2; row++) {
+                std::fill_n(frame->data[plane] + row * frame->linesize[plane], kWidth / 2, 128);
+            }
+        }
+        frame->pts = i;
+        frame->pict_type = i % kGopSize == 0 ? AV_PICTURE_TYPE_I : AV_PICTURE_TYPE_NONE;
+        avcodec_send_frame(ctx, frame);
+        drain();
+    }
+    avcodec_send_frame(ctx, nullptr);
+    drain();
+    av_packet_free(&packet);
+    av_frame_free(&frame);
+    avcodec_free_context(&ctx);
+    return static_cast<int>(packets.size()) == kFrames;
+}
+
+double meanOf(const std::vector<uint8_t>& data) {
+    double sum = 0;
+    for(auto v : data) sum += v;
+    return data.empty() ? 0 : sum / data.size();
+}
+
+class RecordedStreamTest : public ::testing::TestWithParam<VideoDecoder::Codec> {
+   protected:
+    void SetUp() override {
+        if(!recordPackets(GetParam() == VideoDecoder::Codec::H265 ? AV_CODEC_ID_HEVC : AV_CODEC_ID_H264, packets)) {
+            GTEST_SKIP() << "libavcodec has no usable encoder to record the test stream";
+        }
+    }
+    std::vector<std::vector<uint8_t>> packets;
+};
+
+TEST_P(RecordedStreamTest, DecodesEveryPacket) {
+    VideoDecoder decoder(GetParam());
+    std::vector<uint8_t> out;
+    int width = 0, height = 0;
+    ASSERT_TRUE(VideoDecoder::isKeyframe(packets[0].data(), packets[0].size(), GetParam()));
+    for(size_t i = 0; i < packets.size(); i++) {
+        ASSERT_TRUE(decoder.decodeInto(packets[i], CV_8UC1, out, width, height)) << "packet " << i;
+        EXPECT_EQ(width, kWidth);
+        EXPECT_EQ(height, kHeight);
+        ASSERT_EQ(out.size(), static_cast<size_t>(kWidth * kHeight));
+        EXPECT_NEAR(meanOf(out), lumaAt(static_cast<int>(i)), 3.0) << "packet " << i;
+    }
+    ASSERT_TRUE(decoder.decodeInto(packets[0], CV_8UC3, out, width, height));
+    EXPECT_EQ(out.size(), static_cast<size_t>(kWidth * kHeight * 3));
+}
+
+TEST_P(RecordedStreamTest, WaitsForKeyframeAfterReset) {
+    VideoDecoder decoder(GetParam());
+    std::vector<uint8_t> out;
+    int width = 0, height = 0;
+    // Joining mid-GOP produces nothing until the next keyframe.
+    for(int i = 1; i < kGopSize; i++) {
+        EXPECT_FALSE(decoder.decodeInto(packets[i], CV_8UC1, out, width, height)) << "packet " << i;
+    }
+    ASSERT_TRUE(decoder.decodeInto(packets[kGopSize], CV_8UC1, out, width, height));
+    EXPECT_NEAR(meanOf(out), lumaAt(kGopSize), 3.0);
+
+    // Dropped packets are handled by the caller with reset(), same as ImageConverter does on sequence gaps.
+    decoder.reset();
+    EXPECT_FALSE(decoder.decodeInto(packets[kGopSize + 3], CV_8UC1, out, width, height));
+    ASSERT_TRUE(decoder.decodeInto(packets[kGopSize * 2], CV_8UC1, out, width, height));
+    EXPECT_NEAR(meanOf(out), lumaAt(kGopSize * 2), 3.0);
+}
+
+TEST_P(RecordedStreamTest, DecodesAtReducedScale) {
+    VideoDecoder decoder(GetParam());
+    decoder.setScale(2);
+    std::vector<uint8_t> out;
+    int width = 0, height = 0;
+    ASSERT_TRUE(decoder.decodeInto(packets[0], CV_8UC3, out, width, height));
+    EXPECT_EQ(width, kWidth / 2);
+    EXPECT_EQ(height, kHeight / 2);
+    EXPECT_EQ(out.size(), static_cast<size_t>(width * height * 3));
+}
+
+INSTANTIATE_TEST_SUITE_P(Codecs,
+                         RecordedStreamTest,
+                         ::testing::Values(VideoDecoder::Codec::H264, VideoDecoder::Codec::H265),
+                         [](const ::testing::TestParamInfo<VideoDecoder::Codec>& info) {
+                             return info.param == VideoDecoder::Codec::H265 ? "H265" : "H264";
+                         });
+
+#else
+
+TEST(VideoDecoder, ThrowsWithoutLibav) {
+    EXPECT_FALSE(VideoDecoder::isAvailable());
+    VideoDecoder decoder;
+    const std::vector<uint8_t> idr = {0, 0, 0, 1, 0x65, 0x88};
+    std::vector<uint8_t> out;
+    int width, height;
+    EXPECT_THROW(decoder.decodeInto(idr, CV_8UC1, out, width, height), std::runtime_error);
+}
+
+#endif
+
+}  // namespace
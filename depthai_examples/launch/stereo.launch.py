@@ -31,6 +31,7 @@ def generate_launch_description():
     lrcheck        = LaunchConfiguration('lrcheck', default = True)
     extended       = LaunchConfiguration('extended', default = False)
     subpixel       = LaunchConfiguration('subpixel', default = True)
+    subpixelFractionalBits = LaunchConfiguration('subpixelFractionalBits', default = 3)
     confidence     = LaunchConfiguration('confidence', default = 200)
     LRchecktresh   = LaunchConfiguration('LRchecktresh', default = 5)
     monoResolution = LaunchConfiguration('monoResolution',  default = '720p')
@@ -104,6 +105,11 @@ def generate_launch_description():
         'subpixel',
         default_value=subpixel,
         description='The name of the camera. It can be different from the camera model and it will be used as node `namespace`.')
+
+    declare_subpixelFractionalBits_cmd = DeclareLaunchArgument(
+        'subpixelFractionalBits',
+        default_value=subpixelFractionalBits,
+        description='Number of fractional bits of subpixel disparity, 3 to 5. Used by the device and to scale the published disparity.')
     
     declare_confidence_cmd = DeclareLaunchArgument(
         'confidence',
@@ -142,6 +148,7 @@ def generate_launch_description():
                         {'lrcheck': lrcheck},
                         {'extended': extended},
                         {'subpixel': subpixel},
+                        {'subpixelFractionalBits': subpixelFractionalBits},
                         {'confidence': confidence},
                         {'LRchecktresh': LRchecktresh},
                         {'monoResolution': monoResolution}])
@@ -207,6 +214,7 @@ def generate_launch_description():
     ld.add_action(declare_lrcheck_cmd)
     ld.add_action(declare_extended_cmd)
     ld.add_action(declare_subpixel_cmd)
+    ld.add_action(declare_subpixelFractionalBits_cmd)
     ld.add_action(declare_confidence_cmd)
     ld.add_action(declare_LRchecktresh_cmd)
     ld.add_action(declare_monoResolution_cmd)
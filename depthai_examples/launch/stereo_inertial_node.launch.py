@@ -43,6 +43,7 @@ def generate_launch_description():
     lrcheck        = LaunchConfiguration('lrcheck', default = True)
     extended       = LaunchConfiguration('extended', default = False)
     subpixel       = LaunchConfiguration('subpixel', default = True)
+    subpixelFractionalBits = LaunchConfiguration('subpixelFractionalBits', default = 3)
     rectify        = LaunchConfiguration('rectify', default = True)
     depth_aligned  = LaunchConfiguration('depth_aligned', default = True)
     manualExposure = LaunchConfiguration('manualExposure', default = False)
@@ -76,6 +77,9 @@ def generate_launch_description():
     dotProjectormA     = LaunchConfiguration('dotProjectormA', default = 200.0)
     floodLightmA       = LaunchConfiguration('floodLightmA', default = 200.0)
     enableRosBaseTimeUpdate       = LaunchConfiguration('enableRosBaseTimeUpdate', default = False)
+    workerThreads      = LaunchConfiguration('workerThreads', default = 0)
+    enableImuFrameBundles = LaunchConfiguration('enableImuFrameBundles', default = False)
+    imuPreintegration  = LaunchConfiguration('imuPreintegration', default = False)
     enableRviz         = LaunchConfiguration('enableRviz', default = True)
 
 
@@ -171,6 +175,11 @@ def generate_launch_description():
         default_value=subpixel,
         description='Subpixel mode improves the precision and is especially useful for long range measurements. It also helps for better estimating surface normals. Set this parameter to true to enable it')
 
+    declare_subpixelFractionalBits_cmd = DeclareLaunchArgument(
+        'subpixelFractionalBits',
+        default_value=subpixelFractionalBits,
+        description='Number of fractional bits of subpixel disparity, 3 to 5. Used by the device and to scale the published disparity.')
+
     declare_rectify_cmd = DeclareLaunchArgument(
         'rectify',
         default_value=rectify,
@@ -300,6 +309,21 @@ def generate_launch_description():
         default_value=enableRosBaseTimeUpdate,
         description='Whether to update ROS time on each message.')
 
+    declare_workerThreads_cmd = DeclareLaunchArgument(
+        'workerThreads',
+        default_value=workerThreads,
+        description='Number of threads converting messages for all publishers. 0 uses one per CPU core.')
+
+    declare_enableImuFrameBundles_cmd = DeclareLaunchArgument(
+        'enableImuFrameBundles',
+        default_value=enableImuFrameBundles,
+        description='Publish the IMU samples of each depth/disparity frame on imu/frame_bundle.')
+
+    declare_imuPreintegration_cmd = DeclareLaunchArgument(
+        'imuPreintegration',
+        default_value=imuPreintegration,
+        description='Add preintegrated rotation, velocity and position deltas to the IMU frame bundles.')
+
 
     declare_enableRviz_cmd = DeclareLaunchArgument(
         'enableRviz',
@@ -338,6 +362,7 @@ def generate_launch_description():
                         {'lrcheck':                 lrcheck},
                         {'extended':                extended},
                         {'subpixel':                subpixel},
+                        {'subpixelFractionalBits':  subpixelFractionalBits},
                         {'rectify':                 rectify},
 
                         {'depth_aligned':           depth_aligned},
@@ -366,7 +391,10 @@ def generate_launch_description():
                         {'enableFloodLight':        enableFloodLight},
                         {'dotProjectormA':          dotProjectormA},
                         {'floodLightmA':            floodLightmA},
-                        {'enableRosBaseTimeUpdate': enableRosBaseTimeUpdate}
+                        {'enableRosBaseTimeUpdate': enableRosBaseTimeUpdate},
+                        {'workerThreads':           workerThreads},
+                        {'enableImuFrameBundles':   enableImuFrameBundles},
+                        {'imuPreintegration':       imuPreintegration}
                         ])
     
     depth_metric_converter = launch_ros.descriptions.ComposableNode(
@@ -456,6 +484,7 @@ def generate_launch_description():
     ld.add_action(declare_lrcheck_cmd)
     ld.add_action(declare_extended_cmd)
     ld.add_action(declare_subpixel_cmd)
+    ld.add_action(declare_subpixelFractionalBits_cmd)
     ld.add_action(declare_rectify_cmd)
     ld.add_action(declare_depth_aligned_cmd)
     ld.add_action(declare_manualExposure_cmd)
@@ -486,6 +515,9 @@ def generate_launch_description():
     ld.add_action(declare_enableFloodLight_cmd)
     ld.add_action(declare_dotProjectormA_cmd)
     ld.add_action(declare_floodLightmA_cmd)
+    ld.add_action(declare_workerThreads_cmd)
+    ld.add_action(declare_enableImuFrameBundles_cmd)
+    ld.add_action(declare_imuPreintegration_cmd)
 
     ld.add_action(declare_enableRviz_cmd)
 
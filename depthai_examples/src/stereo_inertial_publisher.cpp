@@ -4,6 +4,7 @@
 #include <tuple>
 
 #include "camera_info_manager/camera_info_manager.hpp"
+#include "depthai_ros_msgs/msg/imu_frame_bundle.hpp"
 #include "depthai_ros_msgs/msg/spatial_detection_array.hpp"
 #include "rclcpp/node.hpp"
 #include "sensor_msgs/msg/image.hpp"
@@ -26,6 +27,7 @@
 #include "depthai_bridge/ImageConverter.hpp"
 #include "depthai_bridge/ImuConverter.hpp"
 #include "depthai_bridge/SpatialDetectionConverter.hpp"
+#include "depthai_bridge/WorkerPool.hpp"
 #include "depthai_bridge/depthaiUtility.hpp"
 
 std::vector<std::string> usbStrings = {"UNKNOWN", "LOW", "FULL", "HIGH", "SUPER", "SUPER_PLUS"};
@@ -35,6 +37,7 @@ std::tuple<dai::Pipeline, int, int> createPipeline(bool enableDepth,
                                                    bool lrcheck,
                                                    bool extended,
                                                    bool subpixel,
+                                                   int subpixelFractionalBits,
                                                    bool rectify,
                                                    bool depth_aligned,
                                                    int stereo_fps,
@@ -109,6 +112,9 @@ std::tuple<dai::Pipeline, int, int> createPipeline(bool enableDepth,
     stereo->setLeftRightCheck(lrcheck);
     stereo->setExtendedDisparity(extended);
     stereo->setSubpixel(subpixel);
+    if(subpixel) {
+        stereo->initialConfig.setSubpixelFractionalBits(subpixelFractionalBits);
+    }
     if(enableDepth && depth_aligned) stereo->setDepthAlign(dai::CameraBoardSocket::CAM_A);
 
     // Imu
@@ -290,13 +296,14 @@ int main(int argc, char** argv) {
     std::string tfPrefix, mode, mxId, resourceBaseFolder, nnPath;
     std::string monoResolution = "720p", rgbResolution = "1080p";
     int badParams = 0, stereo_fps, confidence, LRchecktresh, imuModeParam, detectionClassesCount, expTime, sensIso;
-    int rgbScaleNumerator, rgbScaleDinominator, previewWidth, previewHeight;
+    int rgbScaleNumerator, rgbScaleDinominator, previewWidth, previewHeight, subpixelFractionalBits;
     bool lrcheck, extended, subpixel, enableDepth, rectify, depth_aligned, manualExposure;
     bool enableSpatialDetection, enableDotProjector, enableFloodLight;
     bool usb2Mode, poeMode, syncNN;
     double angularVelCovariance, linearAccelCovariance;
     double dotProjectormA, floodLightmA;
-    bool enableRosBaseTimeUpdate;
+    bool enableRosBaseTimeUpdate, enableImuFrameBundles, imuPreintegration;
+    int workerThreads;
     std::string nnName(BLOB_NAME);  // Set your blob name for the model here
 
     node->declare_parameter("mxId", "");
@@ -311,6 +318,7 @@ int main(int argc, char** argv) {
     node->declare_parameter("lrcheck", true);
     node->declare_parameter("extended", false);
     node->declare_parameter("subpixel", true);
+    node->declare_parameter("subpixelFractionalBits", 3);
     node->declare_parameter("rectify", false);
 
     node->declare_parameter("depth_aligned", true);
@@ -340,6 +348,9 @@ int main(int argc, char** argv) {
     node->declare_parameter("dotProjectormA", 200.0);
     node->declare_parameter("floodLightmA", 200.0);
     node->declare_parameter("enableRosBaseTimeUpdate", false);
+    node->declare_parameter("workerThreads", 0);
+    node->declare_parameter("enableImuFrameBundles", false);
+    node->declare_parameter("imuPreintegration", false);
 
     // updating parameters if defined in launch file.
 
@@ -355,6 +366,7 @@ int main(int argc, char** argv) {
     node->get_parameter("lrcheck", lrcheck);
     node->get_parameter("extended", extended);
     node->get_parameter("subpixel", subpixel);
+    node->get_parameter("subpixelFractionalBits", subpixelFractionalBits);
     node->get_parameter("rectify", rectify);
 
     node->get_parameter("depth_aligned", depth_aligned);
@@ -383,6 +395,9 @@ int main(int argc, char** argv) {
     node->get_parameter("dotProjectormA", dotProjectormA);
     node->get_parameter("floodLightmA", floodLightmA);
     node->get_parameter("enableRosBaseTimeUpdate", enableRosBaseTimeUpdate);
+    node->get_parameter("workerThreads", workerThreads);
+    node->get_parameter("enableImuFrameBundles", enableImuFrameBundles);
+    node->get_parameter("imuPreintegration", imuPreintegration);
 
     if(resourceBaseFolder.empty()) {
         throw std::runtime_error("Send the path to the resouce folder containing NNBlob in \'resourceBaseFolder\' ");
@@ -411,6 +426,7 @@ int main(int argc, char** argv) {
                                                        lrcheck,
                                                        extended,
                                                        subpixel,
+                                                       subpixelFractionalBits,
                                                        rectify,
                                                        depth_aligned,
                                                        stereo_fps,
@@ -493,6 +509,11 @@ int main(int argc, char** argv) {
         }
     }
 
+    // All publishers convert on one pool sized to the machine instead of a thread each. IMU and detections are served first,
+    // full resolution images last.
+    auto workerPool = workerThreads > 0 ? std::make_shared<dai::rosBridge::WorkerPool>(workerThreads) : dai::rosBridge::WorkerPool::getInstance();
+    using Priority = dai::rosBridge::WorkerPool::Priority;
+
     dai::rosBridge::ImageConverter converter(tfPrefix + "_left_camera_optical_frame", true);
     if(enableRosBaseTimeUpdate) {
         converter.setUpdateRosBaseTimeOnToRosMsg();
@@ -517,7 +538,26 @@ int main(int argc, char** argv) {
         "",
         "imu");
 
-    imuPublish.addPublisherCallback();
+    imuPublish.addPublisherCallback(workerPool, Priority::HIGH);
+
+    // Bundles the IMU samples of every depth/disparity frame for VIO, the guard removes the callback before the converter goes away.
+    // toRosFrameBundle waits for the IMU conversion on the worker pool to pass the frame, so it runs on the queue's own callback
+    // thread and never on a pool worker.
+    rclcpp::Publisher<depthai_ros_msgs::msg::ImuFrameBundle>::SharedPtr imuBundlePub;
+    std::shared_ptr<void> imuBundleCallback;
+    if(enableImuFrameBundles) {
+        imuConverter.setFrameBundling(true, imuPreintegration);
+        imuBundlePub = node->create_publisher<depthai_ros_msgs::msg::ImuFrameBundle>("imu/frame_bundle", 10);
+        int callbackId = stereoQueue->addCallback([&imuConverter, imuBundlePub](std::shared_ptr<dai::ADatatype> data) {
+            auto frame = std::dynamic_pointer_cast<dai::ImgFrame>(data);
+            if(frame) {
+                auto bundle = std::make_unique<depthai_ros_msgs::msg::ImuFrameBundle>();
+                imuConverter.toRosFrameBundle(frame, *bundle);
+                imuBundlePub->publish(std::move(bundle));
+            }
+        });
+        imuBundleCallback = std::shared_ptr<void>(nullptr, [stereoQueue, callbackId](void*) { stereoQueue->removeCallback(callbackId); });
+    }
 
     // auto leftCameraInfo = converter.calibrationToCameraInfo(calibrationHandler, dai::CameraBoardSocket::CAM_B, monoWidth, monoHeight);
     // auto rightCameraInfo = converter.calibrationToCameraInfo(calibrationHandler, dai::CameraBoardSocket::CAM_C, monoWidth, monoHeight);
@@ -546,7 +586,7 @@ int main(int argc, char** argv) {
             30,
             depthCameraInfo,
             "stereo");
-        depthPublish.addPublisherCallback();
+        depthPublish.addPublisherCallback(workerPool, Priority::NORMAL);
 
         if(depth_aligned) {
             auto rgbCameraInfo = rgbConverter.calibrationToCameraInfo(calibrationHandler, dai::CameraBoardSocket::CAM_A, width, height);
@@ -559,7 +599,7 @@ int main(int argc, char** argv) {
                 30,
                 rgbCameraInfo,
                 "color");
-            rgbPublish.addPublisherCallback();
+            rgbPublish.addPublisherCallback(workerPool, Priority::LOW);
 
             if(enableSpatialDetection) {
                 auto previewQueue = device->getOutputQueue("preview", 30, false);
@@ -574,7 +614,7 @@ int main(int argc, char** argv) {
                     30,
                     previewCameraInfo,
                     "color/preview");
-                previewPublish.addPublisherCallback();
+                previewPublish.addPublisherCallback(workerPool, Priority::NORMAL);
 
                 dai::rosBridge::SpatialDetectionConverter detConverter(tfPrefix + "_rgb_camera_optical_frame", 416, 416, false);
                 dai::rosBridge::BridgePublisher<depthai_ros_msgs::msg::SpatialDetectionArray, dai::SpatialImgDetections> detectionPublish(
@@ -583,7 +623,7 @@ int main(int argc, char** argv) {
                     std::string("color/yolov4_Spatial_detections"),
                     std::bind(&dai::rosBridge::SpatialDetectionConverter::toRosMsg, &detConverter, std::placeholders::_1, std::placeholders::_2),
                     30);
-                detectionPublish.addPublisherCallback();
+                detectionPublish.addPublisherCallback(workerPool, Priority::HIGH);
                 rclcpp::spin(node);
             }
             rclcpp::spin(node);
@@ -609,13 +649,16 @@ int main(int argc, char** argv) {
                 30,
                 rightCameraInfo,
                 "right");
-            rightPublish.addPublisherCallback();
-            leftPublish.addPublisherCallback();
+            rightPublish.addPublisherCallback(workerPool, Priority::LOW);
+            leftPublish.addPublisherCallback(workerPool, Priority::LOW);
             rclcpp::spin(node);
         }
     } else {
         std::string tfSuffix = depth_aligned ? "_rgb_camera_optical_frame" : "_right_camera_optical_frame";
         dai::rosBridge::DisparityConverter dispConverter(tfPrefix + tfSuffix, 880, 7.5, 20, 2000);  // TODO(sachin): undo hardcoding of baseline
+        if(subpixel) {
+            dispConverter.setSubpixelFractionalBits(subpixelFractionalBits);
+        }
         auto rightCameraInfo = converter.calibrationToCameraInfo(calibrationHandler, dai::CameraBoardSocket::CAM_C, width, height);
 
         auto disparityCameraInfo =
@@ -629,7 +672,7 @@ int main(int argc, char** argv) {
             30,
             disparityCameraInfo,
             "stereo");
-        dispPublish.addPublisherCallback();
+        dispPublish.addPublisherCallback(workerPool, Priority::NORMAL);
 
         if(depth_aligned) {
             auto rgbCameraInfo = rgbConverter.calibrationToCameraInfo(calibrationHandler, dai::CameraBoardSocket::CAM_A, width, height);
@@ -643,7 +686,7 @@ int main(int argc, char** argv) {
                 30,
                 rgbCameraInfo,
                 "color");
-            rgbPublish.addPublisherCallback();
+            rgbPublish.addPublisherCallback(workerPool, Priority::LOW);
             if(enableSpatialDetection) {
                 auto previewQueue = device->getOutputQueue("preview", 30, false);
                 auto detectionQueue = device->getOutputQueue("detections", 30, false);
@@ -657,7 +700,7 @@ int main(int argc, char** argv) {
                     30,
                     previewCameraInfo,
                     "color/preview");
-                previewPublish.addPublisherCallback();
+                previewPublish.addPublisherCallback(workerPool, Priority::NORMAL);
 
                 dai::rosBridge::SpatialDetectionConverter detConverter(tfPrefix + "_rgb_camera_optical_frame", 416, 416, false);
                 dai::rosBridge::BridgePublisher<depthai_ros_msgs::msg::SpatialDetectionArray, dai::SpatialImgDetections> detectionPublish(
@@ -666,7 +709,7 @@ int main(int argc, char** argv) {
                     std::string("color/yolov4_Spatial_detections"),
                     std::bind(&dai::rosBridge::SpatialDetectionConverter::toRosMsg, &detConverter, std::placeholders::_1, std::placeholders::_2),
                     30);
-                detectionPublish.addPublisherCallback();
+                detectionPublish.addPublisherCallback(workerPool, Priority::HIGH);
                 rclcpp::spin(node);
             }
             rclcpp::spin(node);
@@ -692,8 +735,8 @@ int main(int argc, char** argv) {
                 30,
                 rightCameraInfo,
                 "right");
-            rightPublish.addPublisherCallback();
-            leftPublish.addPublisherCallback();
+            rightPublish.addPublisherCallback(workerPool, Priority::LOW);
+            leftPublish.addPublisherCallback(workerPool, Priority::LOW);
             rclcpp::spin(node);
         }
     }
@@ -21,7 +21,7 @@
 #include "depthai_bridge/ImageConverter.hpp"
 
 std::tuple<dai::Pipeline, int, int> createPipeline(
-    bool withDepth, bool lrcheck, bool extended, bool subpixel, int confidence, int LRchecktresh, std::string resolution) {
+    bool withDepth, bool lrcheck, bool extended, bool subpixel, int subpixelFractionalBits, int confidence, int LRchecktresh, std::string resolution) {
     dai::Pipeline pipeline;
     dai::node::MonoCamera::Properties::SensorResolution monoResolution;
     auto monoLeft = pipeline.create<dai::node::MonoCamera>();
@@ -76,6 +76,9 @@ std::tuple<dai::Pipeline, int, int> createPipeline(
     stereo->setLeftRightCheck(lrcheck);
     stereo->setExtendedDisparity(extended);
     stereo->setSubpixel(subpixel);
+    if(subpixel) {
+        stereo->initialConfig.setSubpixelFractionalBits(subpixelFractionalBits);
+    }
 
     // Link plugins CAM -> STEREO -> XLINK
     monoLeft->out.link(stereo->left);
@@ -99,7 +102,7 @@ int main(int argc, char** argv) {
 
     std::string tfPrefix, mode, monoResolution;
     bool lrcheck, extended, subpixel, enableDepth;
-    int confidence, LRchecktresh;
+    int subpixelFractionalBits, confidence, LRchecktresh;
     int monoWidth, monoHeight;
     dai::Pipeline pipeline;
 
@@ -108,6 +111,7 @@ int main(int argc, char** argv) {
     node->declare_parameter("lrcheck", true);
     node->declare_parameter("extended", false);
     node->declare_parameter("subpixel", true);
+    node->declare_parameter("subpixelFractionalBits", 3);
     node->declare_parameter("confidence", 200);
     node->declare_parameter("LRchecktresh", 5);
     node->declare_parameter("monoResolution", "720p");
@@ -117,6 +121,7 @@ int main(int argc, char** argv) {
     node->get_parameter("lrcheck", lrcheck);
     node->get_parameter("extended", extended);
     node->get_parameter("subpixel", subpixel);
+    node->get_parameter("subpixelFractionalBits", subpixelFractionalBits);
     node->get_parameter("confidence", confidence);
     node->get_parameter("LRchecktresh", LRchecktresh);
     node->get_parameter("monoResolution", monoResolution);
@@ -127,7 +132,8 @@ int main(int argc, char** argv) {
         enableDepth = false;
     }
 
-    std::tie(pipeline, monoWidth, monoHeight) = createPipeline(enableDepth, lrcheck, extended, subpixel, confidence, LRchecktresh, monoResolution);
+    std::tie(pipeline, monoWidth, monoHeight) =
+        createPipeline(enableDepth, lrcheck, extended, subpixel, subpixelFractionalBits, confidence, LRchecktresh, monoResolution);
     dai::Device device(pipeline);
     auto leftQueue = device.getOutputQueue("left", 30, false);
     auto rightQueue = device.getOutputQueue("right", 30, false);
@@ -190,6 +196,9 @@ int main(int argc, char** argv) {
         rclcpp::spin(node);
     } else {
         dai::rosBridge::DisparityConverter dispConverter(tfPrefix + "_right_camera_optical_frame", 880, 7.5, 20, 2000);
+        if(subpixel) {
+            dispConverter.setSubpixelFractionalBits(subpixelFractionalBits);
+        }
         dai::rosBridge::BridgePublisher<stereo_msgs::msg::DisparityImage, dai::ImgFrame> dispPublish(
             stereoQueue,
             node,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cv_bridge/cv_bridge.h"
+#include "depthai_ros_msgs/msg/packed_tracked_features.hpp"
 #include "depthai_ros_msgs/msg/tracked_features.hpp"
 #include "geometry_msgs/msg/point.hpp"
 #include "message_filters/subscriber.h"
@@ -17,18 +18,26 @@ class FeatureTrackerOverlay : public rclcpp::Node {
     void onInit();
 
     void overlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& img, const depthai_ros_msgs::msg::TrackedFeatures::ConstSharedPtr& detections);
+    void packedOverlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& img, const depthai_ros_msgs::msg::PackedTrackedFeatures::ConstSharedPtr& features);
 
     message_filters::Subscriber<sensor_msgs::msg::Image> imgSub;
     message_filters::Subscriber<depthai_ros_msgs::msg::TrackedFeatures> featureSub;
 
     typedef message_filters::sync_policies::ApproximateTime<sensor_msgs::msg::Image, depthai_ros_msgs::msg::TrackedFeatures> syncPolicy;
     std::unique_ptr<message_filters::Synchronizer<syncPolicy>> sync;
+    message_filters::Subscriber<depthai_ros_msgs::msg::PackedTrackedFeatures> packedFeatureSub;
+    typedef message_filters::sync_policies::ApproximateTime<sensor_msgs::msg::Image, depthai_ros_msgs::msg::PackedTrackedFeatures> packedSyncPolicy;
+    std::unique_ptr<message_filters::Synchronizer<packedSyncPolicy>> packedSync;
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr overlayPub;
 
     using featureIdType = decltype(geometry_msgs::msg::Point::x);
 
    private:
-    void trackFeaturePath(std::vector<depthai_ros_msgs::msg::TrackedFeature>& features);
+    void trackFeaturePath(const std::vector<depthai_ros_msgs::msg::TrackedFeature>& features);
+    void trackFeaturePath(const depthai_ros_msgs::msg::PackedTrackedFeatures& features);
+    void addFeaturePoint(featureIdType id, const geometry_msgs::msg::Point& position, std::unordered_set<featureIdType>& newTrackedIDs);
+    void removeLostFeatures(const std::unordered_set<featureIdType>& newTrackedIDs);
+    void publishOverlay(const sensor_msgs::msg::Image::ConstSharedPtr& img);
 
     void drawFeatures(cv::Mat& img);
 
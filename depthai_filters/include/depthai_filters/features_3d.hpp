@@ -1,5 +1,6 @@
 #pragma once
 
+#include "depthai_ros_msgs/msg/packed_tracked_features.hpp"
 #include "depthai_ros_msgs/msg/tracked_features.hpp"
 #include "message_filters/subscriber.h"
 #include "message_filters/sync_policies/approximate_time.h"
@@ -19,6 +20,9 @@ class Features3D : public rclcpp::Node {
     void overlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
                    const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
                    const depthai_ros_msgs::msg::TrackedFeatures::ConstSharedPtr& features);
+    void packedCB(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
+                  const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
+                  const depthai_ros_msgs::msg::PackedTrackedFeatures::ConstSharedPtr& features);
 
     message_filters::Subscriber<sensor_msgs::msg::Image> depthSub;
     message_filters::Subscriber<depthai_ros_msgs::msg::TrackedFeatures> featureSub;
@@ -27,9 +31,17 @@ class Features3D : public rclcpp::Node {
     typedef message_filters::sync_policies::ApproximateTime<sensor_msgs::msg::Image, sensor_msgs::msg::CameraInfo, depthai_ros_msgs::msg::TrackedFeatures>
         syncPolicy;
     std::unique_ptr<message_filters::Synchronizer<syncPolicy>> sync;
+    message_filters::Subscriber<depthai_ros_msgs::msg::PackedTrackedFeatures> packedFeatureSub;
+    typedef message_filters::sync_policies::ApproximateTime<sensor_msgs::msg::Image, sensor_msgs::msg::CameraInfo, depthai_ros_msgs::msg::PackedTrackedFeatures>
+        packedSyncPolicy;
+    std::unique_ptr<message_filters::Synchronizer<packedSyncPolicy>> packedSync;
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr overlayPub;
     rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pclPub;
     float getDepthAt(int x, int y, const sensor_msgs::msg::Image::ConstSharedPtr& depth_image);
+    void publishCloud(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
+                      const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
+                      const std::vector<float>& xs,
+                      const std::vector<float>& ys);
     bool desqueeze = false;
 };
 
@@ -30,7 +30,8 @@ def launch_setup(context, *args, **kwargs):
                         plugin="depthai_filters::Features3D",
                         remappings=[('stereo/image_raw', name+'/stereo/image_raw'),
                                     ('stereo/camera_info', name+'/stereo/camera_info'),
-                                    ('feature_tracker/tracked_features', name+'/rgb_feature_tracker/tracked_features')]
+                                    ('feature_tracker/tracked_features', name+'/rgb_feature_tracker/tracked_features'),
+                                    ('feature_tracker/tracked_features_packed', name+'/rgb_feature_tracker/tracked_features_packed')]
                     ),
             ],
         ),
@@ -30,6 +30,7 @@ def launch_setup(context, *args, **kwargs):
                         plugin="depthai_filters::FeatureTrackerOverlay",
                         remappings=[('rgb/preview/image_raw', name+'/rgb/image_raw'),
                                     ('feature_tracker/tracked_features', name+'/rgb_feature_tracker/tracked_features'),
+                                    ('feature_tracker/tracked_features_packed', name+'/rgb_feature_tracker/tracked_features_packed'),
                                     ('overlay', 'overlay_rgb')]
                     )
             ],
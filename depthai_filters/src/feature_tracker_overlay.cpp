@@ -10,17 +10,32 @@ FeatureTrackerOverlay::FeatureTrackerOverlay(const rclcpp::NodeOptions& options)
 }
 void FeatureTrackerOverlay::onInit() {
     imgSub.subscribe(this, "rgb/preview/image_raw");
-    featureSub.subscribe(this, "feature_tracker/tracked_features");
-    sync = std::make_unique<message_filters::Synchronizer<syncPolicy>>(syncPolicy(10), imgSub, featureSub);
-    sync->registerCallback(std::bind(&FeatureTrackerOverlay::overlayCB, this, std::placeholders::_1, std::placeholders::_2));
+    if(this->declare_parameter<bool>("packed_features", false)) {
+        packedFeatureSub.subscribe(this, "feature_tracker/tracked_features_packed");
+        packedSync = std::make_unique<message_filters::Synchronizer<packedSyncPolicy>>(packedSyncPolicy(10), imgSub, packedFeatureSub);
+        packedSync->registerCallback(std::bind(&FeatureTrackerOverlay::packedOverlayCB, this, std::placeholders::_1, std::placeholders::_2));
+    } else {
+        featureSub.subscribe(this, "feature_tracker/tracked_features");
+        sync = std::make_unique<message_filters::Synchronizer<syncPolicy>>(syncPolicy(10), imgSub, featureSub);
+        sync->registerCallback(std::bind(&FeatureTrackerOverlay::overlayCB, this, std::placeholders::_1, std::placeholders::_2));
+    }
     overlayPub = this->create_publisher<sensor_msgs::msg::Image>("overlay", 10);
 }
 
 void FeatureTrackerOverlay::overlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& img,
                                       const depthai_ros_msgs::msg::TrackedFeatures::ConstSharedPtr& features) {
+    trackFeaturePath(features->features);
+    publishOverlay(img);
+}
+
+void FeatureTrackerOverlay::packedOverlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& img,
+                                            const depthai_ros_msgs::msg::PackedTrackedFeatures::ConstSharedPtr& features) {
+    trackFeaturePath(*features);
+    publishOverlay(img);
+}
+
+void FeatureTrackerOverlay::publishOverlay(const sensor_msgs::msg::Image::ConstSharedPtr& img) {
     cv::Mat imgMat = utils::msgToMat(this->get_logger(), img, sensor_msgs::image_encodings::BGR8);
-    std::vector<depthai_ros_msgs::msg::TrackedFeature> f = features->features;
-    trackFeaturePath(f);
     drawFeatures(imgMat);
     sensor_msgs::msg::Image outMsg;
     cv_bridge::CvImage(img->header, sensor_msgs::image_encodings::BGR8, imgMat).toImageMsg(outMsg);
@@ -28,23 +43,40 @@ void FeatureTrackerOverlay::overlayCB(const sensor_msgs::msg::Image::ConstShared
     overlayPub->publish(outMsg);
 }
 
-void FeatureTrackerOverlay::trackFeaturePath(std::vector<depthai_ros_msgs::msg::TrackedFeature>& features) {
+void FeatureTrackerOverlay::trackFeaturePath(const std::vector<depthai_ros_msgs::msg::TrackedFeature>& features) {
     std::unordered_set<featureIdType> newTrackedIDs;
-    for(auto& currentFeature : features) {
-        auto currentID = currentFeature.id;
-        newTrackedIDs.insert(currentID);
+    for(const auto& currentFeature : features) {
+        addFeaturePoint(currentFeature.id, currentFeature.position, newTrackedIDs);
+    }
+    removeLostFeatures(newTrackedIDs);
+}
 
-        if(!trackedFeaturesPath.count(currentID)) {
-            trackedFeaturesPath.insert({currentID, std::deque<geometry_msgs::msg::Point>()});
-        }
-        std::deque<geometry_msgs::msg::Point>& path = trackedFeaturesPath.at(currentID);
+void FeatureTrackerOverlay::trackFeaturePath(const depthai_ros_msgs::msg::PackedTrackedFeatures& features) {
+    std::unordered_set<featureIdType> newTrackedIDs;
+    geometry_msgs::msg::Point position;
+    for(size_t i = 0; i < features.id.size(); i++) {
+        position.x = features.x[i];
+        position.y = features.y[i];
+        addFeaturePoint(features.id[i], position, newTrackedIDs);
+    }
+    removeLostFeatures(newTrackedIDs);
+}
 
-        path.push_back(currentFeature.position);
-        while(path.size() > std::max<unsigned int>(1, trackedFeaturesPathLength)) {
-            path.pop_front();
-        }
+void FeatureTrackerOverlay::addFeaturePoint(featureIdType id, const geometry_msgs::msg::Point& position, std::unordered_set<featureIdType>& newTrackedIDs) {
+    newTrackedIDs.insert(id);
+
+    if(!trackedFeaturesPath.count(id)) {
+        trackedFeaturesPath.insert({id, std::deque<geometry_msgs::msg::Point>()});
+    }
+    std::deque<geometry_msgs::msg::Point>& path = trackedFeaturesPath.at(id);
+
+    path.push_back(position);
+    while(path.size() > std::max<unsigned int>(1, trackedFeaturesPathLength)) {
+        path.pop_front();
     }
+}
 
+void FeatureTrackerOverlay::removeLostFeatures(const std::unordered_set<featureIdType>& newTrackedIDs) {
     std::unordered_set<featureIdType> featuresToRemove;
     for(auto& oldId : trackedIDs) {
         if(!newTrackedIDs.count(oldId)) {
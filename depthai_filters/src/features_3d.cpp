@@ -14,9 +14,15 @@ Features3D::Features3D(const rclcpp::NodeOptions& options) : rclcpp::Node("featu
 void Features3D::onInit() {
     depthSub.subscribe(this, "stereo/image_raw");
     infoSub.subscribe(this, "stereo/camera_info");
-    featureSub.subscribe(this, "feature_tracker/tracked_features");
-    sync = std::make_unique<message_filters::Synchronizer<syncPolicy>>(syncPolicy(10), depthSub, infoSub, featureSub);
-    sync->registerCallback(std::bind(&Features3D::overlayCB, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    if(this->declare_parameter<bool>("packed_features", false)) {
+        packedFeatureSub.subscribe(this, "feature_tracker/tracked_features_packed");
+        packedSync = std::make_unique<message_filters::Synchronizer<packedSyncPolicy>>(packedSyncPolicy(10), depthSub, infoSub, packedFeatureSub);
+        packedSync->registerCallback(std::bind(&Features3D::packedCB, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    } else {
+        featureSub.subscribe(this, "feature_tracker/tracked_features");
+        sync = std::make_unique<message_filters::Synchronizer<syncPolicy>>(syncPolicy(10), depthSub, infoSub, featureSub);
+        sync->registerCallback(std::bind(&Features3D::overlayCB, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+    }
     pclPub = this->create_publisher<sensor_msgs::msg::PointCloud2>("features", 10);
     overlayPub = this->create_publisher<sensor_msgs::msg::Image>("overlay", 10);
     desqueeze = this->declare_parameter<bool>("desqueeze", false);
@@ -38,11 +44,29 @@ float Features3D::getDepthAt(int x, int y, const sensor_msgs::msg::Image::ConstS
 void Features3D::overlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
                            const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
                            const depthai_ros_msgs::msg::TrackedFeatures::ConstSharedPtr& features) {
+    std::vector<float> xs, ys;
+    xs.reserve(features->features.size());
+    ys.reserve(features->features.size());
+    for(const auto& feature : features->features) {
+        xs.push_back(feature.position.x);
+        ys.push_back(feature.position.y);
+    }
+    publishCloud(depth, info, xs, ys);
+}
+void Features3D::packedCB(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
+                          const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
+                          const depthai_ros_msgs::msg::PackedTrackedFeatures::ConstSharedPtr& features) {
+    publishCloud(depth, info, features->x, features->y);
+}
+void Features3D::publishCloud(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
+                              const sensor_msgs::msg::CameraInfo::ConstSharedPtr& info,
+                              const std::vector<float>& xs,
+                              const std::vector<float>& ys) {
     sensor_msgs::msg::PointCloud2 cloud;
     cloud.header.frame_id = info->header.frame_id;  // Set this to your camera's frame
     cloud.header.stamp = this->get_clock()->now();
     cloud.height = 1;
-    cloud.width = features->features.size();  // assuming features is your vector of 2D points
+    cloud.width = xs.size();
     sensor_msgs::PointCloud2Modifier pcd_modifier(cloud);
     pcd_modifier.setPointCloud2FieldsByString(1, "xyz");
     sensor_msgs::PointCloud2Iterator<float> out_x(cloud, "x");
@@ -52,10 +76,10 @@ void Features3D::overlayCB(const sensor_msgs::msg::Image::ConstSharedPtr& depth,
     double fy = info->k[4];
     double cx = info->k[2];
     double cy = info->k[5];
-    for(const auto& feature : features->features) {
-        float depthVal = getDepthAt(feature.position.x, feature.position.y, depth);  // Define this function based on your depth image structure
-        *out_x = (feature.position.x - cx) * depthVal / fx;
-        *out_y = (feature.position.y - cy) * depthVal / fy;
+    for(size_t i = 0; i < xs.size(); i++) {
+        float depthVal = getDepthAt(xs[i], ys[i], depth);
+        *out_x = (xs[i] - cx) * depthVal / fx;
+        *out_y = (ys[i] - cy) * depthVal / fy;
         *out_z = depthVal;
         ++out_x;
         ++out_y;
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "depthai_bridge/TFPublisher.hpp"
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
 #include "depthai_ros_driver/param_handlers/camera_param_handler.hpp"
-#include "diagnostic_msgs/msg/diagnostic_array.hpp"
 #include "rclcpp/node.hpp"
+#include "std_msgs/msg/string.hpp"
 #include "std_srvs/srv/trigger.hpp"
 
 namespace dai {
@@ -17,20 +21,50 @@ class Device;
 }  // namespace dai
 
 namespace depthai_ros_driver {
+class DeviceManager;
+class PublisherCache;
 using Trigger = std_srvs::srv::Trigger;
 class Camera : public rclcpp::Node {
    public:
     explicit Camera(const rclcpp::NodeOptions& options = rclcpp::NodeOptions());
     /**
-     * @brief      Destructor of the class Camera. Stops the device and destroys the pipeline.
+     * @brief      Destructor of the class Camera. Cancels waiting for a device, waits for the running operation, then stops the
+     * camera, so the queues are closed before the nodes using them are destroyed.
      */
     ~Camera();
     /**
-     * @brief Creates the pipeline and starts the device. Also sets up parameter callback and services.
+     * @brief Creates the pipeline and starts the device.
      */
     void onConfigure();
 
    private:
+    /**
+     * @brief      Sets up parameter callback and services. They stay registered while the camera is stopped.
+     */
+    void createServices();
+    /**
+     * @brief      Runs a start, stop, restart, activate or deactivate on the operation thread, so the executor keeps serving other
+     * callbacks. Progress is published on ~/status. A repeated request for the running operation is merged into it, other requests
+     * are rejected until it finishes.
+     *
+     * @param[in]  operation  Name of the operation
+     * @param[in]  fn         The operation, runs with cameraMutex locked
+     * @param[out] message    Why the request was rejected or merged
+     *
+     * @return     False if the request was rejected.
+     */
+    bool runOperation(const std::string& operation, std::function<void()> fn, std::string& message);
+    void setStatus(const std::string& status);
+    /**
+     * @brief      Connects the device, builds and starts the pipeline and sets up the queues. Logs the time spent in each phase.
+     *
+     * @param[in]  mxId  MXID of the device to connect to, empty to select the device by parameters
+     */
+    void startCamera(const std::string& mxId = "");
+    /**
+     * @brief      Creates the TF publisher, unless it was already created for the connected device.
+     */
+    void setupTF();
     /**
      * @brief      Print information about the device type.
      */
@@ -40,9 +74,12 @@ class Camera : public rclcpp::Node {
      */
     void createPipeline();
     /**
-     * @brief      Connect either to a first available device or to a device with a specific USB port, MXID or IP. Loops continuously until a device is found.
+     * @brief      Connect either to a first available device or to a device with a specific USB port, MXID or IP. Waits until the DeviceManager
+     * shared by cameras in the process boots the device.
+     *
+     * @param[in]  mxId  MXID overriding the one from parameters, empty to use parameters
      */
-    void startDevice();
+    void startDevice(const std::string& mxId = "");
     /**
      * @brief      Sets up the queues and creates publishers for the nodes in the pipeline.
      */
@@ -67,28 +104,64 @@ class Camera : public rclcpp::Node {
     rcl_interfaces::msg::SetParametersResult parameterCB(const std::vector<rclcpp::Parameter>& params);
     OnSetParametersCallbackHandle::SharedPtr paramCBHandle;
     std::unique_ptr<param_handlers::CameraParamHandler> ph;
-    rclcpp::Service<Trigger>::SharedPtr startSrv, stopSrv, savePipelineSrv, saveCalibSrv;
-    rclcpp::Subscription<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagSub;
+    rclcpp::Service<Trigger>::SharedPtr startSrv, stopSrv, savePipelineSrv, saveCalibSrv, activateSrv, deactivateSrv;
     /*
-     * Closes all the queues, clears the configured BaseNodes, stops the pipeline and resets the device.
+     * Closes all the queues, retires the configured BaseNodes, stops the pipeline and resets the device.
      */
     void stop();
+    /*
+     * Hands the configured BaseNodes over to the executor for destruction. Their timers, services and publishers may be in use by
+     * the executor while an operation runs, e.g. the SysLogger diagnostics timer that requested a restart, so they are destroyed
+     * in a one-shot timer callback, which the executor never runs concurrently with the other callbacks of the node.
+     */
+    void retireNodes();
     /*
      * Runs onConfigure();
      */
     void start();
+    /*
+     * Stops the camera and starts it again on the same device. Services, callbacks, publishers and the TF publisher are kept.
+     */
     void restart();
-    void diagCB(const diagnostic_msgs::msg::DiagnosticArray::SharedPtr msg);
+    /*
+     * Starts streaming of a camera on standby. Only sensors are resumed, the device, pipeline and queues stay as configured.
+     */
+    void activate();
+    /*
+     * Puts the camera on standby. Sensors stop streaming and IR is turned off, but the device stays booted with the pipeline
+     * loaded, so activate() resumes in milliseconds.
+     */
+    void deactivate();
+    /*
+     * Called by the SysLogger while the device sends no system information. Restarts the camera if i_restart_on_diagnostics_error is set.
+     */
+    void deviceErrorCB(const std::string& error);
 
     void startCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
     void stopCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
+    void activateCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
+    void deactivateCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
     void saveCalibCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
     void savePipelineCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res);
     std::vector<std::string> usbStrings = {"UNKNOWN", "LOW", "FULL", "HIGH", "SUPER", "SUPER_PLUS"};
     std::shared_ptr<dai::Pipeline> pipeline;
     std::shared_ptr<dai::Device> device;
+    std::shared_ptr<DeviceManager> deviceManager;
+    std::shared_ptr<PublisherCache> publisherCache;
     std::vector<std::unique_ptr<dai_nodes::BaseNode>> daiNodes;
+    std::mutex retiredNodesMutex;
+    std::vector<std::unique_ptr<dai_nodes::BaseNode>> retiredNodes;
+    rclcpp::TimerBase::SharedPtr teardownTimer;
     bool camRunning = false;
+    bool camActive = true;
+    // Held by the operation thread for the whole operation and by callbacks using the device, pipeline or nodes.
+    std::recursive_mutex cameraMutex;
+    std::mutex operationMutex;
+    std::future<void> operationFuture;
+    std::string currentOperation;
+    std::shared_ptr<std::atomic<bool>> operationsCancelled;
+    rclcpp::Publisher<std_msgs::msg::String>::SharedPtr statusPub;
     std::unique_ptr<dai::ros::TFPublisher> tfPub;
+    std::string tfDeviceMxId;
 };
 }  // namespace depthai_ros_driver
\ No newline at end of file
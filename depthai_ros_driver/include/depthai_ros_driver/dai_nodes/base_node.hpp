@@ -4,10 +4,14 @@
 #include <string>
 
 #include "depthai/pipeline/Node.hpp"
+#include "depthai_ros_driver/publisher_cache.hpp"
 
 namespace dai {
 class Pipeline;
 class Device;
+namespace ros {
+class SubscriptionTracker;
+}
 }  // namespace dai
 
 namespace rclcpp {
@@ -43,6 +47,14 @@ class BaseNode {
      */
     virtual void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) = 0;
     virtual void closeQueues() = 0;
+    /**
+     * @brief      Resumes streaming after deactivate(). The pipeline and queues stay as they were set up.
+     */
+    virtual void activate();
+    /**
+     * @brief      Stops streaming while the pipeline keeps running on the device, so it can be resumed without reconfiguring.
+     */
+    virtual void deactivate();
 
     void setNodeName(const std::string& daiNodeName);
     void setROSNodePointer(rclcpp::Node* node);
@@ -65,9 +77,41 @@ class BaseNode {
      */
     std::string getTFPrefix(const std::string& frameName = "");
     bool ipcEnabled();
+    /**
+     * @brief      Gets the subscription tracker of the ROS node, created on first use.
+     *
+     * @return     The subscription tracker.
+     */
+    std::shared_ptr<dai::ros::SubscriptionTracker> getSubscriptionTracker();
+    /**
+     * @brief      Gets the publisher of the topic from the publisher cache of the ROS node, so publishers outlive pipeline restarts.
+     *
+     * @param[in]  topic    The topic
+     * @param[in]  qos      The QoS, used only when the publisher is created
+     * @param[in]  options  The publisher options, used only when the publisher is created
+     *
+     * @return     The publisher.
+     */
+    template <typename MessageT>
+    std::shared_ptr<rclcpp::Publisher<MessageT>> getPublisher(const std::string& topic,
+                                                              const rclcpp::QoS& qos,
+                                                              const rclcpp::PublisherOptions& options = rclcpp::PublisherOptions()) {
+        return getPublisherCache()->getPublisher<MessageT>(topic, qos, options);
+    }
+    /**
+     * @brief      Gets the image_transport camera publisher of the topic from the publisher cache of the ROS node.
+     *
+     * @param[in]  topic  The topic
+     *
+     * @return     The camera publisher.
+     */
+    image_transport::CameraPublisher getCameraPublisher(const std::string& topic);
 
    private:
+    std::shared_ptr<PublisherCache> getPublisherCache();
     rclcpp::Node* baseNode;
+    std::shared_ptr<dai::ros::SubscriptionTracker> subscriptionTracker;
+    std::shared_ptr<PublisherCache> publisherCache;
     std::string baseDAINodeName;
     bool intraProcessEnabled;
 };
@@ -74,16 +74,16 @@ class Detection : public BaseNode {
         }
         detConverter = std::make_unique<dai::ros::ImgDetectionConverter>(
             tfPrefix + "_camera_optical_frame", width, height, false, ph->getParam<bool>("i_get_base_device_timestamp"));
-        detConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+        detConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
         rclcpp::PublisherOptions options;
         options.qos_overriding_options = rclcpp::QosOverridingOptions();
-        detPub = getROSNode()->template create_publisher<vision_msgs::msg::Detection2DArray>("~/" + getName() + "/detections", 10, options);
+        detPub = getPublisher<vision_msgs::msg::Detection2DArray>("~/" + getName() + "/detections", 10, options);
         nnQ->addCallback(std::bind(&Detection::detectionCB, this, std::placeholders::_1, std::placeholders::_2));
 
         if(ph->getParam<bool>("i_enable_passthrough")) {
             ptQ = device->getOutputQueue(ptQName, ph->getParam<int>("i_max_q_size"), false);
             imageConverter = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false);
-            imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+            imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
             infoManager = std::make_shared<camera_info_manager::CameraInfoManager>(
                 getROSNode()->create_sub_node(std::string(getROSNode()->get_name()) + "/" + getName()).get(), "/" + getName());
             infoManager->setCameraInfo(sensor_helpers::getCalibInfo(getROSNode()->get_logger(),
@@ -93,8 +93,14 @@ class Detection : public BaseNode {
                                                                     width,
                                                                     height));
 
-            ptPub = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/passthrough/image_raw");
-            ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub, std::placeholders::_1, std::placeholders::_2, *imageConverter, ptPub, infoManager));
+            ptPub = getCameraPublisher("~/" + getName() + "/passthrough/image_raw");
+            ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub,
+                                       std::placeholders::_1,
+                                       std::placeholders::_2,
+                                       *imageConverter,
+                                       ptPub,
+                                       infoManager,
+                                       getSubscriptionTracker()->track(ptPub)));
         }
     };
     /**
@@ -162,17 +168,13 @@ class Detection : public BaseNode {
      */
     void detectionCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
         auto inDet = std::dynamic_pointer_cast<dai::ImgDetections>(data);
-        std::deque<vision_msgs::msg::Detection2DArray> deq;
-        detConverter->toRosMsg(inDet, deq);
-        while(deq.size() > 0) {
-            auto currMsg = deq.front();
-            detPub->publish(currMsg);
-            deq.pop_front();
-        }
+        detConverter->toRosMsgInPlace(inDet, detMsg);
+        sensor_helpers::publishReused(detPub, detMsg);
     };
     std::unique_ptr<dai::ros::ImgDetectionConverter> detConverter;
     std::vector<std::string> labelNames;
     rclcpp::Publisher<vision_msgs::msg::Detection2DArray>::SharedPtr detPub;
+    std::unique_ptr<vision_msgs::msg::Detection2DArray> detMsg;
     std::unique_ptr<dai::ros::ImageConverter> imageConverter;
     image_transport::CameraPublisher ptPub;
     std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager;
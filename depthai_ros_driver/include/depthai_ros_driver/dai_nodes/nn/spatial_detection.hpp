@@ -63,16 +63,16 @@ class SpatialDetection : public BaseNode {
         }
         detConverter = std::make_unique<dai::ros::SpatialDetectionConverter>(
             tfPrefix + "_camera_optical_frame", width, height, false, ph->getParam<bool>("i_get_base_device_timestamp"));
-        detConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+        detConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
         nnQ->addCallback(std::bind(&SpatialDetection::spatialCB, this, std::placeholders::_1, std::placeholders::_2));
         rclcpp::PublisherOptions options;
         options.qos_overriding_options = rclcpp::QosOverridingOptions();
-        detPub = getROSNode()->template create_publisher<vision_msgs::msg::Detection3DArray>("~/" + getName() + "/spatial_detections", 10, options);
+        detPub = getPublisher<vision_msgs::msg::Detection3DArray>("~/" + getName() + "/spatial_detections", 10, options);
 
         if(ph->getParam<bool>("i_enable_passthrough")) {
             ptQ = device->getOutputQueue(ptQName, ph->getParam<int>("i_max_q_size"), false);
             ptImageConverter = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false);
-            ptImageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+            ptImageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
             ptInfoMan = std::make_shared<camera_info_manager::CameraInfoManager>(
                 getROSNode()->create_sub_node(std::string(getROSNode()->get_name()) + "/" + getName()).get(), "/" + getName());
             ptInfoMan->setCameraInfo(sensor_helpers::getCalibInfo(getROSNode()->get_logger(),
@@ -82,8 +82,14 @@ class SpatialDetection : public BaseNode {
                                                                   width,
                                                                   height));
 
-            ptPub = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/passthrough/image_raw");
-            ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub, std::placeholders::_1, std::placeholders::_2, *ptImageConverter, ptPub, ptInfoMan));
+            ptPub = getCameraPublisher("~/" + getName() + "/passthrough/image_raw");
+            ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub,
+                                       std::placeholders::_1,
+                                       std::placeholders::_2,
+                                       *ptImageConverter,
+                                       ptPub,
+                                       ptInfoMan,
+                                       getSubscriptionTracker()->track(ptPub)));
         }
 
         if(ph->getParam<bool>("i_enable_passthrough_depth")) {
@@ -93,7 +99,7 @@ class SpatialDetection : public BaseNode {
             };
             ptDepthQ = device->getOutputQueue(ptDepthQName, ph->getParam<int>("i_max_q_size"), false);
             ptDepthImageConverter = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false);
-            ptDepthImageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+            ptDepthImageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
             ptDepthInfoMan = std::make_shared<camera_info_manager::CameraInfoManager>(
                 getROSNode()->create_sub_node(std::string(getROSNode()->get_name()) + "/" + getName()).get(), "/" + getName());
             ptDepthInfoMan->setCameraInfo(sensor_helpers::getCalibInfo(getROSNode()->get_logger(),
@@ -103,9 +109,14 @@ class SpatialDetection : public BaseNode {
                                                                        ph->getOtherNodeParam<int>("stereo", "i_width"),
                                                                        ph->getOtherNodeParam<int>("stereo", "i_height")));
 
-            ptDepthPub = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/passthrough_depth/image_raw");
-            ptDepthQ->addCallback(
-                std::bind(sensor_helpers::basicCameraPub, std::placeholders::_1, std::placeholders::_2, *ptDepthImageConverter, ptDepthPub, ptDepthInfoMan));
+            ptDepthPub = getCameraPublisher("~/" + getName() + "/passthrough_depth/image_raw");
+            ptDepthQ->addCallback(std::bind(sensor_helpers::basicCameraPub,
+                                            std::placeholders::_1,
+                                            std::placeholders::_2,
+                                            *ptDepthImageConverter,
+                                            ptDepthPub,
+                                            ptDepthInfoMan,
+                                            getSubscriptionTracker()->track(ptDepthPub)));
         }
     };
     void link(dai::Node::Input in, int /*linkType = 0*/) override {
@@ -154,17 +165,13 @@ class SpatialDetection : public BaseNode {
    private:
     void spatialCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
         auto inDet = std::dynamic_pointer_cast<dai::SpatialImgDetections>(data);
-        std::deque<vision_msgs::msg::Detection3DArray> deq;
-        detConverter->toRosVisionMsg(inDet, deq);
-        while(deq.size() > 0) {
-            auto currMsg = deq.front();
-            detPub->publish(currMsg);
-            deq.pop_front();
-        }
+        detConverter->toRosVisionMsgInPlace(inDet, detMsg);
+        sensor_helpers::publishReused(detPub, detMsg);
     };
     std::unique_ptr<dai::ros::SpatialDetectionConverter> detConverter;
     std::vector<std::string> labelNames;
     rclcpp::Publisher<vision_msgs::msg::Detection3DArray>::SharedPtr detPub;
+    std::unique_ptr<vision_msgs::msg::Detection3DArray> detMsg;
     std::unique_ptr<dai::ros::ImageConverter> ptImageConverter, ptDepthImageConverter;
     image_transport::CameraPublisher ptPub, ptDepthPub;
     sensor_msgs::msg::CameraInfo ptInfo, ptDepthInfo;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
+#include "depthai_ros_msgs/msg/packed_tracked_features.hpp"
 #include "depthai_ros_msgs/msg/tracked_features.hpp"
 #include "rclcpp/publisher.hpp"
 
@@ -45,7 +46,10 @@ class FeatureTracker : public BaseNode {
    private:
     std::unique_ptr<dai::ros::TrackedFeaturesConverter> featureConverter;
     void featureQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
+    void packedFeatureQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
     rclcpp::Publisher<depthai_ros_msgs::msg::TrackedFeatures>::SharedPtr featurePub;
+    rclcpp::Publisher<depthai_ros_msgs::msg::PackedTrackedFeatures>::SharedPtr packedFeaturePub;
+    std::unique_ptr<depthai_ros_msgs::msg::PackedTrackedFeatures> packedFeatureMsg;
     std::shared_ptr<dai::node::FeatureTracker> featureNode;
     std::unique_ptr<param_handlers::FeatureTrackerParamHandler> ph;
     std::shared_ptr<dai::DataOutputQueue> featureQ;
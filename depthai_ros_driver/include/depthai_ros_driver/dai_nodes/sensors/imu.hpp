@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
+
+#include "depthai_bridge/SubscriptionTracker.hpp"
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
+#include "depthai_ros_msgs/msg/imu_batch.hpp"
 #include "depthai_ros_msgs/msg/imu_with_magnetic_field.hpp"
 #include "rclcpp/publisher.hpp"
 #include "sensor_msgs/msg/imu.hpp"
@@ -41,20 +45,30 @@ class Imu : public BaseNode {
     void setNames() override;
     void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) override;
     void closeQueues() override;
+    void activate() override;
+    void deactivate() override;
 
    private:
     std::unique_ptr<dai::ros::ImuConverter> imuConverter;
     void imuRosQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
     void imuDaiRosQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
     void imuMagQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
+    /**
+     * @brief Publishes the packet on the batch topic, per sample topics only get copies while they have subscribers.
+     */
+    void imuBatchQCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
     rclcpp::Publisher<sensor_msgs::msg::Imu>::SharedPtr rosImuPub;
     rclcpp::Publisher<sensor_msgs::msg::MagneticField>::SharedPtr magPub;
     rclcpp::Publisher<depthai_ros_msgs::msg::ImuWithMagneticField>::SharedPtr daiImuPub;
+    rclcpp::Publisher<depthai_ros_msgs::msg::ImuBatch>::SharedPtr batchPub;
+    dai::ros::SubscriptionTracker::Flag imuSubscribed, magSubscribed;
     std::shared_ptr<dai::node::IMU> imuNode;
     std::unique_ptr<param_handlers::ImuParamHandler> ph;
     std::shared_ptr<dai::DataOutputQueue> imuQ;
     std::shared_ptr<dai::node::XLinkOut> xoutImu;
     std::string imuQName;
+    // The IMU can not be paused on the device, so its data is dropped on the host while deactivated.
+    std::atomic<bool> active{true};
 };
 
 }  // namespace dai_nodes
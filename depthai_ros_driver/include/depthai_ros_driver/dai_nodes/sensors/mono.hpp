@@ -1,10 +1,12 @@
 #pragma once
 
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
+#include "depthai_ros_msgs/msg/ffmpeg_packet.hpp"
 #include "depthai_ros_driver/dai_nodes/sensors/sensor_helpers.hpp"
 #include "image_transport/camera_publisher.hpp"
 #include "image_transport/image_transport.hpp"
 #include "sensor_msgs/msg/camera_info.hpp"
+#include "sensor_msgs/msg/compressed_image.hpp"
 #include "sensor_msgs/msg/image.hpp"
 
 namespace dai {
@@ -54,12 +56,16 @@ class Mono : public BaseNode {
     void setNames() override;
     void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) override;
     void closeQueues() override;
+    void activate() override;
+    void deactivate() override;
 
    private:
     std::unique_ptr<dai::ros::ImageConverter> imageConverter;
     image_transport::CameraPublisher monoPubIT;
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr monoPub;
     rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub;
+    rclcpp::Publisher<sensor_msgs::msg::CompressedImage>::SharedPtr compressedPub;
+    rclcpp::Publisher<depthai_ros_msgs::msg::FFMPEGPacket>::SharedPtr packetPub;
     std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager;
     std::shared_ptr<dai::node::MonoCamera> monoCamNode;
     std::shared_ptr<dai::node::VideoEncoder> videoEnc;
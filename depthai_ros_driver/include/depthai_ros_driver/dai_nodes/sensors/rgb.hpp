@@ -1,9 +1,11 @@
 #pragma once
 
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
+#include "depthai_ros_msgs/msg/ffmpeg_packet.hpp"
 #include "image_transport/camera_publisher.hpp"
 #include "image_transport/image_transport.hpp"
 #include "sensor_msgs/msg/camera_info.hpp"
+#include "sensor_msgs/msg/compressed_image.hpp"
 #include "sensor_msgs/msg/image.hpp"
 
 namespace dai {
@@ -58,12 +60,16 @@ class RGB : public BaseNode {
     void setNames() override;
     void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) override;
     void closeQueues() override;
+    void activate() override;
+    void deactivate() override;
 
    private:
     std::unique_ptr<dai::ros::ImageConverter> imageConverter;
     image_transport::CameraPublisher rgbPubIT, previewPubIT;
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr rgbPub, previewPub;
     rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr rgbInfoPub, previewInfoPub;
+    rclcpp::Publisher<sensor_msgs::msg::CompressedImage>::SharedPtr rgbCompressedPub;
+    rclcpp::Publisher<depthai_ros_msgs::msg::FFMPEGPacket>::SharedPtr rgbPacketPub;
     std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager, previewInfoManager;
     std::shared_ptr<dai::node::ColorCamera> colorCamNode;
     std::shared_ptr<dai::node::VideoEncoder> videoEnc;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <deque>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -10,10 +11,15 @@
 #include "depthai-shared/properties/VideoEncoderProperties.hpp"
 #include "depthai/pipeline/datatype/ADatatype.hpp"
 #include "depthai/pipeline/datatype/CameraControl.hpp"
+#include "depthai_bridge/SubscriptionTracker.hpp"
+#include "depthai_ros_msgs/msg/ffmpeg_packet.hpp"
 #include "image_transport/camera_publisher.hpp"
 #include "sensor_msgs/msg/camera_info.hpp"
+#include "sensor_msgs/msg/compressed_image.hpp"
+#include "sensor_msgs/msg/image.hpp"
 
 namespace dai {
+class CalibrationHandler;
 class Device;
 class Pipeline;
 namespace node {
@@ -50,17 +56,20 @@ extern const std::unordered_map<std::string, dai::MonoCameraProperties::SensorRe
 extern const std::unordered_map<std::string, dai::ColorCameraProperties::SensorResolution> rgbResolutionMap;
 extern const std::unordered_map<std::string, dai::CameraControl::FrameSyncMode> fSyncModeMap;
 extern const std::unordered_map<std::string, dai::CameraImageOrientation> cameraImageOrientationMap;
+extern const std::unordered_map<std::string, dai::VideoEncoderProperties::Profile> encoderProfileMap;
 void basicCameraPub(const std::string& /*name*/,
                     const std::shared_ptr<dai::ADatatype>& data,
                     dai::ros::ImageConverter& converter,
                     image_transport::CameraPublisher& pub,
-                    std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager);
+                    std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+                    dai::ros::SubscriptionTracker::Flag subscribed);
 
 void cameraPub(const std::string& /*name*/,
                const std::shared_ptr<dai::ADatatype>& data,
                dai::ros::ImageConverter& converter,
                image_transport::CameraPublisher& pub,
                std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+               dai::ros::SubscriptionTracker::Flag subscribed,
                bool lazyPub = true);
 
 void splitPub(const std::string& /*name*/,
@@ -69,19 +78,91 @@ void splitPub(const std::string& /*name*/,
               rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
               rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
               std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+              dai::ros::SubscriptionTracker::Flag subscribed,
               bool lazyPub = true);
 
+/**
+ * @brief Publishes encoder bitstream frames unchanged on compressedPub, decoding them only when imgPub has subscribers.
+ */
+void compressedPub(const std::string& /*name*/,
+                   const std::shared_ptr<dai::ADatatype>& data,
+                   dai::ros::ImageConverter& converter,
+                   rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
+                   rclcpp::Publisher<sensor_msgs::msg::CompressedImage>::SharedPtr compressedPub,
+                   rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+                   std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+                   dai::ros::SubscriptionTracker::Flag rawSubscribed,
+                   dai::ros::SubscriptionTracker::Flag compressedSubscribed,
+                   dai::ros::SubscriptionTracker::Flag infoSubscribed,
+                   bool lazyPub = true);
+
+/**
+ * @brief Publishes H.264/H.265 bitstream frames unchanged on packetPub. Frames are decoded for imgPub only while it has subscribers
+ * and the bridge was built with a video decoder, decoding resumes from the next keyframe after a pause.
+ */
+void videoPub(const std::string& /*name*/,
+              const std::shared_ptr<dai::ADatatype>& data,
+              dai::ros::ImageConverter& converter,
+              rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
+              rclcpp::Publisher<depthai_ros_msgs::msg::FFMPEGPacket>::SharedPtr packetPub,
+              rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+              std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+              dai::ros::SubscriptionTracker::Flag rawSubscribed,
+              dai::ros::SubscriptionTracker::Flag packetSubscribed,
+              dai::ros::SubscriptionTracker::Flag infoSubscribed,
+              bool lazyPub = true);
+
+/**
+ * @brief Returns the device calibration, read from the device only on first use and cached per device afterwards.
+ */
+dai::CalibrationHandler getCalibHandler(std::shared_ptr<dai::Device> device);
+
+/**
+ * @brief Drops cached calibration and CameraInfo, e.g. after new calibration data was loaded.
+ * @param mxId: Device to drop the cache for, empty drops it for all devices.
+ */
+void invalidateCalibCache(const std::string& mxId = "");
+
+/**
+ * @brief Generates CameraInfo from the cached device calibration. Results are memoized per device, socket, size and the
+ * converter's alpha scaling and stereo socket order, so every stream asking for the same info only computes it once.
+ */
 sensor_msgs::msg::CameraInfo getCalibInfo(const rclcpp::Logger& logger,
                                           dai::ros::ImageConverter& converter,
                                           std::shared_ptr<dai::Device> device,
                                           dai::CameraBoardSocket socket,
                                           int width = 0,
                                           int height = 0);
+/**
+ * @brief Creates a VideoEncoder node.
+ * @param bitrate: Target bitrate in kbps for H.264/H.265 profiles, 0 lets the encoder pick one from resolution and frame rate.
+ * @param keyframeFrequency: Distance between keyframes for H.264/H.265 profiles, also bounds how long a new subscriber waits for a decodable frame.
+ */
 std::shared_ptr<dai::node::VideoEncoder> createEncoder(std::shared_ptr<dai::Pipeline> pipeline,
                                                        int quality,
-                                                       dai::VideoEncoderProperties::Profile profile = dai::VideoEncoderProperties::Profile::MJPEG);
+                                                       dai::VideoEncoderProperties::Profile profile = dai::VideoEncoderProperties::Profile::MJPEG,
+                                                       int bitrate = 0,
+                                                       int keyframeFrequency = 30);
 bool detectSubscription(const rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr& pub,
                         const rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr& infoPub);
+/**
+ * @brief Cached detectSubscription, the flag is updated by the tracker on graph changes instead of querying the graph per frame.
+ */
+dai::ros::SubscriptionTracker::Flag trackSubscription(dai::ros::SubscriptionTracker& tracker,
+                                                      const rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr& pub,
+                                                      const rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr& infoPub);
+/**
+ * @brief Publishes a message that a converter fills in place. Intra-process subscribers take it over without a copy, otherwise it
+ * is serialized from a reference and kept, so the next conversion reuses its memory.
+ */
+template <typename MessageT>
+void publishReused(const std::shared_ptr<rclcpp::Publisher<MessageT>>& pub, std::unique_ptr<MessageT>& msg) {
+    if(pub->get_intra_process_subscription_count() > 0) {
+        pub->publish(std::move(msg));
+    } else {
+        pub->publish(*msg);
+    }
+}
 }  // namespace sensor_helpers
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
\ No newline at end of file
@@ -49,6 +49,8 @@ class SensorWrapper : public BaseNode {
     void setNames() override;
     void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) override;
     void closeQueues() override;
+    void activate() override;
+    void deactivate() override;
     sensor_helpers::ImageSensor getSensorData();
 
    private:
@@ -6,10 +6,12 @@
 
 #include "depthai-shared/common/CameraBoardSocket.hpp"
 #include "depthai-shared/common/CameraFeatures.hpp"
+#include "depthai_bridge/SubscriptionTracker.hpp"
 #include "depthai_ros_driver/dai_nodes/sensors/sensor_wrapper.hpp"
 #include "image_transport/camera_publisher.hpp"
 #include "image_transport/image_transport.hpp"
 #include "sensor_msgs/msg/camera_info.hpp"
+#include "sensor_msgs/msg/compressed_image.hpp"
 #include "sensor_msgs/msg/image.hpp"
 
 namespace dai {
@@ -63,6 +65,8 @@ class Stereo : public BaseNode {
     void setNames() override;
     void setXinXout(std::shared_ptr<dai::Pipeline> pipeline) override;
     void closeQueues() override;
+    void activate() override;
+    void deactivate() override;
 
    private:
     void setupStereoQueue(std::shared_ptr<dai::Device> device);
@@ -74,9 +78,10 @@ class Stereo : public BaseNode {
                         std::unique_ptr<dai::ros::ImageConverter>& conv,
                         std::shared_ptr<camera_info_manager::CameraInfoManager>& im,
                         std::shared_ptr<dai::DataOutputQueue>& q,
-                        rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr pub,
-                        rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+                        rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr& pub,
+                        rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr& infoPub,
                         image_transport::CameraPublisher& pubIT,
+                        dai::ros::SubscriptionTracker::Flag& subscribed,
                         bool isLeft);
     /*
      * This callback is used to synchronize left and right rectified frames
@@ -88,7 +93,9 @@ class Stereo : public BaseNode {
     image_transport::CameraPublisher stereoPubIT, leftRectPubIT, rightRectPubIT;
     rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr stereoPub, leftRectPub, rightRectPub;
     rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr stereoInfoPub, leftRectInfoPub, rightRectInfoPub;
+    rclcpp::Publisher<sensor_msgs::msg::CompressedImage>::SharedPtr stereoCompressedPub;
     std::shared_ptr<camera_info_manager::CameraInfoManager> stereoIM, leftRectIM, rightRectIM;
+    dai::ros::SubscriptionTracker::Flag leftRectSubscribed, rightRectSubscribed;
     std::shared_ptr<dai::node::StereoDepth> stereoCamNode;
     std::shared_ptr<dai::node::VideoEncoder> stereoEnc, leftRectEnc, rightRectEnc;
     std::unique_ptr<SensorWrapper> left;
@@ -1,5 +1,13 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
 #include "depthai/pipeline/datatype/SystemInformation.hpp"
 #include "depthai_ros_driver/dai_nodes/base_node.hpp"
+#include "depthai_ros_msgs/msg/system_information.hpp"
 #include "diagnostic_updater/diagnostic_updater.hpp"
 namespace dai {
 class Pipeline;
@@ -22,7 +30,15 @@ namespace depthai_ros_driver {
 namespace dai_nodes {
 class SysLogger : public BaseNode {
    public:
-    SysLogger(const std::string& daiNodeName, rclcpp::Node* node, std::shared_ptr<dai::Pipeline> pipeline);
+    /**
+     * @brief      Constructor of the class SysLogger.
+     *
+     * @param      errorCB  Called from the diagnostics timer when the device stops sending system information
+     */
+    SysLogger(const std::string& daiNodeName,
+              rclcpp::Node* node,
+              std::shared_ptr<dai::Pipeline> pipeline,
+              std::function<void(const std::string&)> errorCB = nullptr);
     ~SysLogger();
     void setupQueues(std::shared_ptr<dai::Device> device) override;
     void setNames() override;
@@ -30,8 +46,28 @@ class SysLogger : public BaseNode {
     void closeQueues() override;
 
    private:
-    std::string sysInfoToString(const dai::SystemInformation& sysInfo);
+    /**
+     * @brief Publishes the system information as numeric fields and keeps it with the time it arrived, so the diagnostics callback
+     * never waits for the device.
+     */
+    void sysInfoCB(const std::string& name, const std::shared_ptr<dai::ADatatype>& data);
+    /**
+     * @brief Reports whether system information arrives, with the values of the last report as key-values. The same values are
+     * published on ~/<name>/system_information.
+     */
     void produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& stat);
+    std::function<void(const std::string&)> errorCB;
+    // Written by the queue callback and read by the diagnostics callback, in steady clock nanoseconds. Zero until the first report.
+    std::atomic<int64_t> lastReceivedNs{0};
+    // Only touched by the diagnostics callback, so errorCB fires once when the device goes stale and not on every tick.
+    bool stale = false;
+    // Last published report, replaced by the queue callback and read by the diagnostics callback.
+    std::shared_ptr<const depthai_ros_msgs::msg::SystemInformation> lastSysInfo;
+    std::mutex lastSysInfoMtx;
+    rclcpp::Publisher<depthai_ros_msgs::msg::SystemInformation>::SharedPtr sysInfoPub;
+    std::chrono::steady_clock::time_point setupTime;
+    // Set by closeQueues, the diagnostics timer keeps running until the executor destroys the node and must not report errors.
+    std::atomic<bool> closed{false};
     std::shared_ptr<diagnostic_updater::Updater> updater;
     std::shared_ptr<dai::node::XLinkOut> xoutLogger;
     std::shared_ptr<dai::node::SystemLogger> sysNode;
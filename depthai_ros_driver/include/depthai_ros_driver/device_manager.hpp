@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "depthai/device/Device.hpp"
+#include "rclcpp/logger.hpp"
+
+namespace depthai_ros_driver {
+/**
+ * @brief Hands out DepthAI devices to the Camera nodes running in one process. Devices are enumerated once for all cameras waiting
+ * at the same time, a device is given to only one camera and every device boots on its own thread, so cameras starting together
+ * boot in parallel instead of one after another.
+ */
+class DeviceManager : public std::enable_shared_from_this<DeviceManager> {
+   public:
+    /**
+     * @brief Selects the device to boot. If all identifiers are empty, the next available device is used.
+     */
+    struct DeviceRequest {
+        std::string mxId;
+        std::string ip;
+        std::string usbPortId;
+        dai::UsbSpeed usbSpeed = dai::UsbSpeed::SUPER_PLUS;
+        // Optional, setting it to true stops waiting for the device.
+        std::shared_ptr<const std::atomic<bool>> cancelled;
+    };
+
+    /**
+     * @brief Manager shared by the cameras of the process. Created on first use.
+     */
+    static std::shared_ptr<DeviceManager> getInstance();
+
+    /**
+     * @brief Finds and boots the requested device on a separate thread. Retries with exponential backoff until the device boots,
+     * or ROS shuts down or the request is cancelled in which case the future holds nullptr. The device is handed out again only after the returned pointer
+     * and all its copies are released.
+     */
+    std::future<std::shared_ptr<dai::Device>> acquireDevice(const DeviceRequest& request, const rclcpp::Logger& logger);
+
+   private:
+    std::shared_ptr<dai::Device> bootDevice(const DeviceRequest& request, const rclcpp::Logger& logger);
+    /**
+     * @brief Enumerates devices, or returns the result of an enumeration that just finished for another camera.
+     */
+    std::vector<dai::DeviceInfo> getAvailableDevices();
+    /**
+     * @brief Picks the first unclaimed device matching the request and claims it. Throws if the requested device is booted by a
+     * different process.
+     */
+    bool claimDevice(const DeviceRequest& request, const std::vector<dai::DeviceInfo>& devices, dai::DeviceInfo& claimed, const rclcpp::Logger& logger);
+    void releaseDevice(const std::string& mxId);
+
+    std::mutex enumerationMutex;
+    std::vector<dai::DeviceInfo> availableDevices;
+    std::chrono::steady_clock::time_point lastEnumeration;
+    std::mutex claimMutex;
+    std::set<std::string> claimedDevices;
+};
+}  // namespace depthai_ros_driver
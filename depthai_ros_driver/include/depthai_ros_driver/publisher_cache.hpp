@@ -0,0 +1,87 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <utility>
+
+#include "image_transport/camera_publisher.hpp"
+#include "image_transport/image_transport.hpp"
+#include "rclcpp/node.hpp"
+
+namespace depthai_ros_driver {
+/**
+ * @brief Keeps the publishers of a ROS node alive between pipeline rebuilds. Nodes recreated on restart get the publisher they had
+ * before instead of advertising the topic again, so subscribers stay connected and no discovery round is needed.
+ */
+class PublisherCache {
+   public:
+    explicit PublisherCache(rclcpp::Node* node);
+    PublisherCache(const PublisherCache&) = delete;
+    PublisherCache& operator=(const PublisherCache&) = delete;
+
+    /**
+     * @brief Cache shared by everything publishing from the same node. Created on first use.
+     */
+    static std::shared_ptr<PublisherCache> getInstance(rclcpp::Node* node);
+
+    /**
+     * @brief Returns the publisher of the topic and message type, creating it if there is none yet. QoS and options only apply
+     * when the publisher is created.
+     */
+    template <typename MessageT>
+    std::shared_ptr<rclcpp::Publisher<MessageT>> getPublisher(const std::string& topic,
+                                                              const rclcpp::QoS& qos,
+                                                              const rclcpp::PublisherOptions& options = rclcpp::PublisherOptions()) {
+        return getOrCreate<rclcpp::Publisher<MessageT>>(topic, [&]() { return rosNode->create_publisher<MessageT>(topic, qos, options); });
+    }
+
+    /**
+     * @brief Returns the image_transport camera publisher of the topic, creating it if there is none yet.
+     */
+    image_transport::CameraPublisher getCameraPublisher(const std::string& topic);
+
+    /**
+     * @brief Marks all publishers as unused, called before the nodes request their publishers again.
+     */
+    void resetUsage();
+
+    /**
+     * @brief Drops publishers not requested since the last resetUsage(), e.g. of streams disabled by the new configuration.
+     *
+     * @return     Number of dropped publishers.
+     */
+    size_t releaseUnused();
+
+    /**
+     * @brief Number of publishers handed out again since the last resetUsage().
+     */
+    size_t getReusedCount();
+
+   private:
+    struct Entry {
+        std::shared_ptr<void> publisher;
+        bool used = false;
+    };
+
+    template <typename PublisherT, typename CreateFn>
+    std::shared_ptr<PublisherT> getOrCreate(const std::string& topic, CreateFn create) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& entry = entries[std::make_pair(topic, std::type_index(typeid(PublisherT)))];
+        if(entry.publisher) {
+            reusedCount++;
+        } else {
+            entry.publisher = create();
+        }
+        entry.used = true;
+        return std::static_pointer_cast<PublisherT>(entry.publisher);
+    }
+
+    rclcpp::Node* rosNode;
+    std::mutex cacheMutex;
+    std::map<std::pair<std::string, std::type_index>, Entry> entries;
+    size_t reusedCount = 0;
+};
+}  // namespace depthai_ros_driver
@@ -1,71 +1,180 @@
 #include "depthai_ros_driver/camera.hpp"
 
+#include <chrono>
 #include <fstream>
 
 #include "ament_index_cpp/get_package_share_directory.hpp"
 #include "depthai/device/Device.hpp"
 #include "depthai/pipeline/Pipeline.hpp"
 #include "depthai_bridge/TFPublisher.hpp"
+#include "depthai_ros_driver/dai_nodes/sys_logger.hpp"
+#include "depthai_ros_driver/device_manager.hpp"
+#include "depthai_ros_driver/dai_nodes/sensors/sensor_helpers.hpp"
 #include "depthai_ros_driver/pipeline/pipeline_generator.hpp"
-#include "diagnostic_msgs/msg/diagnostic_status.hpp"
+#include "depthai_ros_driver/publisher_cache.hpp"
+#include "std_msgs/msg/string.hpp"
 
 namespace depthai_ros_driver {
 
+static long toMs(std::chrono::steady_clock::duration duration) {
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+}
+
 Camera::Camera(const rclcpp::NodeOptions& options) : rclcpp::Node("camera", options) {
     ph = std::make_unique<param_handlers::CameraParamHandler>(this, "camera");
     ph->declareParams();
-    onConfigure();
+    publisherCache = PublisherCache::getInstance(this);
+    camActive = ph->getParam<bool>("i_activate_on_start");
+    operationsCancelled = std::make_shared<std::atomic<bool>>(false);
+    statusPub = this->create_publisher<std_msgs::msg::String>("~/status", rclcpp::QoS(1).transient_local());
+    createServices();
+    // Waiting for the device can take long, so the node comes up right away and the camera boots on the operation thread.
+    std::string message;
+    runOperation("start", [this]() { onConfigure(); }, message);
+}
+Camera::~Camera() {
+    *operationsCancelled = true;
+    std::lock_guard<std::mutex> lock(operationMutex);
+    if(operationFuture.valid()) {
+        operationFuture.wait();
+    }
+    std::lock_guard<std::recursive_mutex> cameraLock(cameraMutex);
+    stop();
+    // The executor no longer runs callbacks of a node being destroyed, so retired nodes go right away.
+    std::lock_guard<std::mutex> retiredLock(retiredNodesMutex);
+    teardownTimer.reset();
+    retiredNodes.clear();
 }
-Camera::~Camera() = default;
 void Camera::onConfigure() {
-    getDeviceType();
-    createPipeline();
-    device->startPipeline(*pipeline);
-    setupQueues();
-    setIR();
+    startCamera();
+    setupTF();
+    RCLCPP_INFO(this->get_logger(), "Camera ready!");
+}
+
+void Camera::createServices() {
     paramCBHandle = this->add_on_set_parameters_callback(std::bind(&Camera::parameterCB, this, std::placeholders::_1));
     startSrv = this->create_service<Trigger>("~/start_camera", std::bind(&Camera::startCB, this, std::placeholders::_1, std::placeholders::_2));
     stopSrv = this->create_service<Trigger>("~/stop_camera", std::bind(&Camera::stopCB, this, std::placeholders::_1, std::placeholders::_2));
     savePipelineSrv = this->create_service<Trigger>("~/save_pipeline", std::bind(&Camera::savePipelineCB, this, std::placeholders::_1, std::placeholders::_2));
     saveCalibSrv = this->create_service<Trigger>("~/save_calibration", std::bind(&Camera::saveCalibCB, this, std::placeholders::_1, std::placeholders::_2));
+    activateSrv = this->create_service<Trigger>("~/activate_camera", std::bind(&Camera::activateCB, this, std::placeholders::_1, std::placeholders::_2));
+    deactivateSrv =
+        this->create_service<Trigger>("~/deactivate_camera", std::bind(&Camera::deactivateCB, this, std::placeholders::_1, std::placeholders::_2));
+}
+
+bool Camera::runOperation(const std::string& operation, std::function<void()> fn, std::string& message) {
+    std::lock_guard<std::mutex> lock(operationMutex);
+    if(operationFuture.valid() && operationFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        // A repeated request is merged into the running operation, any other one is rejected until it finishes.
+        if(operation == currentOperation) {
+            message = "Camera " + operation + " already in progress.";
+            return true;
+        }
+        message = "Camera busy, " + currentOperation + " in progress.";
+        return false;
+    }
+    currentOperation = operation;
+    operationFuture = std::async(std::launch::async, [this, operation, fn]() {
+        std::lock_guard<std::recursive_mutex> cameraLock(cameraMutex);
+        try {
+            fn();
+        } catch(const std::exception& e) {
+            RCLCPP_ERROR(this->get_logger(), "Camera %s failed: %s", operation.c_str(), e.what());
+            setStatus("error");
+        }
+    });
+    message = "Camera " + operation + " started.";
+    return true;
+}
+
+void Camera::setStatus(const std::string& status) {
+    std_msgs::msg::String msg;
+    msg.data = status;
+    statusPub->publish(msg);
+}
+
+void Camera::startCamera(const std::string& mxId) {
+    try {
+        auto deviceStart = std::chrono::steady_clock::now();
+        setStatus("connecting");
+        pipeline = std::make_shared<dai::Pipeline>();
+        startDevice(mxId);
+        getDeviceType();
+        auto pipelineStart = std::chrono::steady_clock::now();
+        setStatus("configuring");
+        publisherCache->resetUsage();
+        createPipeline();
+        auto queuesStart = std::chrono::steady_clock::now();
+        setStatus("starting");
+        device->startPipeline(*pipeline);
+        setupQueues();
+        if(camActive) {
+            setIR();
+        } else {
+            for(const auto& node : daiNodes) {
+                node->deactivate();
+            }
+            RCLCPP_INFO(this->get_logger(), "Camera on standby, call ~/activate_camera to start streaming.");
+        }
+        size_t releasedPublishers = publisherCache->releaseUnused();
+        auto end = std::chrono::steady_clock::now();
+        RCLCPP_INFO(this->get_logger(),
+                    "Camera started in %ld ms (device: %ld ms, pipeline: %ld ms, queues: %ld ms). Reused %zu publishers, released %zu.",
+                    toMs(end - deviceStart),
+                    toMs(pipelineStart - deviceStart),
+                    toMs(queuesStart - pipelineStart),
+                    toMs(end - queuesStart),
+                    publisherCache->getReusedCount(),
+                    releasedPublishers);
+        setStatus(camActive ? "streaming" : "standby");
+    } catch(...) {
+        // Queues of a partially started camera are closed together with the device, before the nodes using them go away.
+        device.reset();
+        retireNodes();
+        pipeline.reset();
+        camRunning = false;
+        throw;
+    }
+}
 
+void Camera::setupTF() {
+    if(!ph->getParam<bool>("i_publish_tf_from_calibration")) {
+        return;
+    }
+    // Static transforms and the robot description are latched, they only change if a different device got connected.
+    if(tfPub && tfDeviceMxId == device->getMxId()) {
+        return;
+    }
     // If model name not set get one from the device
     std::string camModel = ph->getParam<std::string>("i_tf_camera_model");
     if(camModel.empty()) {
         camModel = device->getDeviceName();
     }
-
-    if(ph->getParam<bool>("i_publish_tf_from_calibration")) {
-        tfPub = std::make_unique<dai::ros::TFPublisher>(this,
-                                                        device->readCalibration(),
-                                                        device->getConnectedCameraFeatures(),
-                                                        ph->getParam<std::string>("i_tf_camera_name"),
-                                                        camModel,
-                                                        ph->getParam<std::string>("i_tf_base_frame"),
-                                                        ph->getParam<std::string>("i_tf_parent_frame"),
-                                                        ph->getParam<std::string>("i_tf_cam_pos_x"),
-                                                        ph->getParam<std::string>("i_tf_cam_pos_y"),
-                                                        ph->getParam<std::string>("i_tf_cam_pos_z"),
-                                                        ph->getParam<std::string>("i_tf_cam_roll"),
-                                                        ph->getParam<std::string>("i_tf_cam_pitch"),
-                                                        ph->getParam<std::string>("i_tf_cam_yaw"),
-                                                        ph->getParam<std::string>("i_tf_imu_from_descr"),
-                                                        ph->getParam<std::string>("i_tf_custom_urdf_location"),
-                                                        ph->getParam<std::string>("i_tf_custom_xacro_args"));
-    }
-    diagSub = this->create_subscription<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 10, std::bind(&Camera::diagCB, this, std::placeholders::_1));
-    RCLCPP_INFO(this->get_logger(), "Camera ready!");
+    tfPub = std::make_unique<dai::ros::TFPublisher>(this,
+                                                    dai_nodes::sensor_helpers::getCalibHandler(device),
+                                                    device->getConnectedCameraFeatures(),
+                                                    ph->getParam<std::string>("i_tf_camera_name"),
+                                                    camModel,
+                                                    ph->getParam<std::string>("i_tf_base_frame"),
+                                                    ph->getParam<std::string>("i_tf_parent_frame"),
+                                                    ph->getParam<std::string>("i_tf_cam_pos_x"),
+                                                    ph->getParam<std::string>("i_tf_cam_pos_y"),
+                                                    ph->getParam<std::string>("i_tf_cam_pos_z"),
+                                                    ph->getParam<std::string>("i_tf_cam_roll"),
+                                                    ph->getParam<std::string>("i_tf_cam_pitch"),
+                                                    ph->getParam<std::string>("i_tf_cam_yaw"),
+                                                    ph->getParam<std::string>("i_tf_imu_from_descr"),
+                                                    ph->getParam<std::string>("i_tf_custom_urdf_location"),
+                                                    ph->getParam<std::string>("i_tf_custom_xacro_args"));
+    tfDeviceMxId = device->getMxId();
 }
 
-void Camera::diagCB(const diagnostic_msgs::msg::DiagnosticArray::SharedPtr msg) {
-    for(const auto& status : msg->status) {
-        if(status.name == get_name() + std::string(": sys_logger")) {
-            if(status.level == diagnostic_msgs::msg::DiagnosticStatus::ERROR) {
-                RCLCPP_ERROR(this->get_logger(), "Camera diagnostics error: %s", status.message.c_str());
-                if(ph->getParam<bool>("i_restart_on_diagnostics_error")) {
-                    restart();
-                };
-            }
+void Camera::deviceErrorCB(const std::string& error) {
+    RCLCPP_ERROR(this->get_logger(), "Camera diagnostics error: %s", error.c_str());
+    if(ph->getParam<bool>("i_restart_on_diagnostics_error")) {
+        std::string message;
+        if(!runOperation("restart", [this]() { restart(); }, message)) {
+            RCLCPP_WARN(this->get_logger(), "%s", message.c_str());
         }
     }
 }
@@ -82,24 +191,101 @@ void Camera::start() {
 void Camera::stop() {
     RCLCPP_INFO(this->get_logger(), "Stopping camera.");
     if(camRunning) {
+        setStatus("stopping");
         for(const auto& node : daiNodes) {
             node->closeQueues();
         }
-        daiNodes.clear();
+        retireNodes();
         device.reset();
         pipeline.reset();
         camRunning = false;
+        setStatus("stopped");
     } else {
         RCLCPP_INFO(this->get_logger(), "Camera already stopped!");
     }
 }
 
+void Camera::retireNodes() {
+    if(daiNodes.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(retiredNodesMutex);
+    for(auto& node : daiNodes) {
+        retiredNodes.push_back(std::move(node));
+    }
+    daiNodes.clear();
+    if(!teardownTimer) {
+        // Creating the timer wakes the executor, the callback runs as soon as the current callback of the node returns.
+        teardownTimer = this->create_wall_timer(std::chrono::milliseconds(0), [this]() {
+            std::vector<std::unique_ptr<dai_nodes::BaseNode>> nodes;
+            {
+                std::lock_guard<std::mutex> lock(retiredNodesMutex);
+                nodes.swap(retiredNodes);
+                teardownTimer->cancel();
+                teardownTimer.reset();
+            }
+            RCLCPP_DEBUG(this->get_logger(), "Destroying %zu stopped nodes.", nodes.size());
+        });
+    }
+}
+
+void Camera::activate() {
+    if(!camRunning) {
+        RCLCPP_INFO(this->get_logger(), "Camera not running, it will stream once started.");
+        camActive = true;
+        return;
+    }
+    if(camActive) {
+        RCLCPP_INFO(this->get_logger(), "Camera already active!");
+        return;
+    }
+    auto activateStart = std::chrono::steady_clock::now();
+    for(const auto& node : daiNodes) {
+        node->activate();
+    }
+    setIR();
+    camActive = true;
+    setStatus("streaming");
+    RCLCPP_INFO(this->get_logger(), "Camera activated in %ld ms.", toMs(std::chrono::steady_clock::now() - activateStart));
+}
+
+void Camera::deactivate() {
+    if(!camRunning) {
+        RCLCPP_INFO(this->get_logger(), "Camera not running, it will stay on standby once started.");
+        camActive = false;
+        return;
+    }
+    if(!camActive) {
+        RCLCPP_INFO(this->get_logger(), "Camera already on standby!");
+        return;
+    }
+    auto deactivateStart = std::chrono::steady_clock::now();
+    for(const auto& node : daiNodes) {
+        node->deactivate();
+    }
+    if(ph->getParam<bool>("i_enable_ir") && !device->getIrDrivers().empty()) {
+        device->setIrLaserDotProjectorBrightness(0);
+        device->setIrFloodLightBrightness(0);
+    }
+    camActive = false;
+    setStatus("standby");
+    RCLCPP_INFO(this->get_logger(), "Camera deactivated in %ld ms.", toMs(std::chrono::steady_clock::now() - deactivateStart));
+}
+
 void Camera::restart() {
     RCLCPP_ERROR(this->get_logger(), "Restarting camera");
+    auto restartStart = std::chrono::steady_clock::now();
+    // Reconnect to the same device, even if any available device was requested, so the calibration and TF stay valid.
+    std::string mxId = device ? device->getMxId() : "";
     stop();
-    start();
+    auto stopEnd = std::chrono::steady_clock::now();
+    startCamera(mxId);
+    setupTF();
     if(camRunning) {
-        return;
+        RCLCPP_INFO(this->get_logger(),
+                    "Camera restarted in %ld ms (stop: %ld ms).",
+                    toMs(std::chrono::steady_clock::now() - restartStart),
+                    toMs(stopEnd - restartStart));
     } else {
         RCLCPP_ERROR(this->get_logger(), "Restarting camera failed.");
     }
@@ -118,9 +304,16 @@ void Camera::loadCalib(const std::string& path) {
     RCLCPP_INFO(this->get_logger(), "Reading calibration from: %s", path.c_str());
     dai::CalibrationHandler cH(path);
     pipeline->setCalibrationData(cH);
+    dai_nodes::sensor_helpers::invalidateCalibCache(device->getMxId());
 }
 
 void Camera::saveCalibCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
+    std::unique_lock<std::recursive_mutex> lock(cameraMutex, std::try_to_lock);
+    if(!lock.owns_lock() || !camRunning) {
+        res->success = false;
+        res->message = "Camera not running or busy.";
+        return;
+    }
     saveCalib();
     res->success = true;
 }
@@ -135,21 +328,29 @@ void Camera::savePipeline() {
 }
 
 void Camera::savePipelineCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
+    std::unique_lock<std::recursive_mutex> lock(cameraMutex, std::try_to_lock);
+    if(!lock.owns_lock() || !camRunning) {
+        res->success = false;
+        res->message = "Camera not running or busy.";
+        return;
+    }
     savePipeline();
     res->success = true;
 }
 
 void Camera::startCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
-    start();
-    res->success = true;
+    res->success = runOperation("start", [this]() { start(); }, res->message);
 }
 void Camera::stopCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
-    stop();
-    res->success = true;
+    res->success = runOperation("stop", [this]() { stop(); }, res->message);
+}
+void Camera::activateCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
+    res->success = runOperation("activate", [this]() { activate(); }, res->message);
+}
+void Camera::deactivateCB(const Trigger::Request::SharedPtr /*req*/, Trigger::Response::SharedPtr res) {
+    res->success = runOperation("deactivate", [this]() { deactivate(); }, res->message);
 }
 void Camera::getDeviceType() {
-    pipeline = std::make_shared<dai::Pipeline>();
-    startDevice();
     auto name = device->getDeviceName();
     RCLCPP_INFO(this->get_logger(), "Device type: %s", name.c_str());
     for(auto& sensor : device->getCameraSensorNames()) {
@@ -170,6 +371,9 @@ void Camera::createPipeline() {
     }
     daiNodes = generator->createPipeline(
         this, device, pipeline, ph->getParam<std::string>("i_pipeline_type"), ph->getParam<std::string>("i_nn_type"), ph->getParam<bool>("i_enable_imu"));
+    // Device health goes straight to the camera instead of a round trip through /diagnostics.
+    daiNodes.push_back(
+        std::make_unique<dai_nodes::SysLogger>("sys_logger", this, pipeline, std::bind(&Camera::deviceErrorCB, this, std::placeholders::_1)));
     if(ph->getParam<bool>("i_pipeline_dump")) {
         savePipeline();
     }
@@ -184,58 +388,21 @@ void Camera::setupQueues() {
     }
 }
 
-void Camera::startDevice() {
-    rclcpp::Rate r(1.0);
-    while(rclcpp::ok() && !camRunning) {
-        auto mxid = ph->getParam<std::string>("i_mx_id");
-        auto ip = ph->getParam<std::string>("i_ip");
-        auto usb_id = ph->getParam<std::string>("i_usb_port_id");
-        try {
-            if(mxid.empty() && ip.empty() && usb_id.empty()) {
-                RCLCPP_INFO(this->get_logger(), "No ip/mxid specified, connecting to the next available device.");
-                device = std::make_shared<dai::Device>();
-                camRunning = true;
-            } else {
-                std::vector<dai::DeviceInfo> availableDevices = dai::Device::getAllAvailableDevices();
-                if(availableDevices.size() == 0) {
-                    throw std::runtime_error("No devices detected!");
-                }
-                dai::UsbSpeed speed = ph->getUSBSpeed();
-                for(const auto& info : availableDevices) {
-                    if(!mxid.empty() && info.getMxId() == mxid) {
-                        RCLCPP_INFO(this->get_logger(), "Connecting to the camera using mxid: %s", mxid.c_str());
-                        if(info.state == X_LINK_UNBOOTED || info.state == X_LINK_BOOTLOADER) {
-                            device = std::make_shared<dai::Device>(info, speed);
-                            camRunning = true;
-                        } else if(info.state == X_LINK_BOOTED) {
-                            throw std::runtime_error("Device is already booted in different process.");
-                        }
-                    } else if(!ip.empty() && info.name == ip) {
-                        RCLCPP_INFO(this->get_logger(), "Connecting to the camera using ip: %s", ip.c_str());
-                        if(info.state == X_LINK_UNBOOTED || info.state == X_LINK_BOOTLOADER) {
-                            device = std::make_shared<dai::Device>(info);
-                            camRunning = true;
-                        } else if(info.state == X_LINK_BOOTED) {
-                            throw std::runtime_error("Device is already booted in different process.");
-                        }
-                    } else if(!usb_id.empty() && info.name == usb_id) {
-                        RCLCPP_INFO(this->get_logger(), "Connecting to the camera using USB ID: %s", usb_id.c_str());
-                        if(info.state == X_LINK_UNBOOTED || info.state == X_LINK_BOOTLOADER) {
-                            device = std::make_shared<dai::Device>(info, speed);
-                            camRunning = true;
-                        } else if(info.state == X_LINK_BOOTED) {
-                            throw std::runtime_error("Device is already booted in different process.");
-                        }
-                    } else {
-                        RCLCPP_INFO(this->get_logger(), "Ignoring device info: MXID: %s, Name: %s", info.getMxId().c_str(), info.name.c_str());
-                    }
-                }
-            }
-        } catch(const std::runtime_error& e) {
-            RCLCPP_ERROR(this->get_logger(), "%s", e.what());
-        }
-        r.sleep();
+void Camera::startDevice(const std::string& mxId) {
+    if(!deviceManager) {
+        deviceManager = DeviceManager::getInstance();
+    }
+    DeviceManager::DeviceRequest request;
+    request.mxId = mxId.empty() ? ph->getParam<std::string>("i_mx_id") : mxId;
+    request.ip = ph->getParam<std::string>("i_ip");
+    request.usbPortId = ph->getParam<std::string>("i_usb_port_id");
+    request.usbSpeed = ph->getUSBSpeed();
+    request.cancelled = operationsCancelled;
+    device = deviceManager->acquireDevice(request, this->get_logger()).get();
+    if(!device) {
+        throw std::runtime_error("Shutdown or camera destruction requested before a device was connected.");
     }
+    camRunning = true;
 
     RCLCPP_INFO(this->get_logger(), "Camera with MXID: %s and Name: %s connected!", device->getMxId().c_str(), device->getDeviceInfo().name.c_str());
     auto protocol = device->getDeviceInfo().getXLinkDeviceDesc().protocol;
@@ -258,8 +425,16 @@ void Camera::setIR() {
 }
 
 rcl_interfaces::msg::SetParametersResult Camera::parameterCB(const std::vector<rclcpp::Parameter>& params) {
+    rcl_interfaces::msg::SetParametersResult res;
+    // Parameters declared by nodes created on the operation thread pass, as that thread already holds the lock.
+    std::unique_lock<std::recursive_mutex> lock(cameraMutex, std::try_to_lock);
+    if(!lock.owns_lock()) {
+        res.successful = false;
+        res.reason = "Camera is starting or stopping, try again once it finishes.";
+        return res;
+    }
     for(const auto& p : params) {
-        if(ph->getParam<bool>("i_enable_ir") && !device->getIrDrivers().empty()) {
+        if(camRunning && camActive && ph->getParam<bool>("i_enable_ir") && !device->getIrDrivers().empty()) {
             if(p.get_name() == ph->getFullParamName("i_laser_dot_brightness")) {
                 device->setIrLaserDotProjectorBrightness(p.get_value<int>());
             } else if(p.get_name() == ph->getFullParamName("i_floodlight_brightness")) {
@@ -270,7 +445,6 @@ rcl_interfaces::msg::SetParametersResult Camera::parameterCB(const std::vector<r
     for(const auto& node : daiNodes) {
         node->updateParams(params);
     }
-    rcl_interfaces::msg::SetParametersResult res;
     res.successful = true;
     return res;
 }
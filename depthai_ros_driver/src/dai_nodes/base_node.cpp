@@ -3,6 +3,7 @@
 #include "depthai-shared/common/CameraBoardSocket.hpp"
 #include "depthai/device/Device.hpp"
 #include "depthai/pipeline/Pipeline.hpp"
+#include "depthai_bridge/SubscriptionTracker.hpp"
 #include "rclcpp/node.hpp"
 
 namespace depthai_ros_driver {
@@ -30,6 +31,24 @@ bool BaseNode::ipcEnabled() {
     return intraProcessEnabled;
 }
 
+std::shared_ptr<dai::ros::SubscriptionTracker> BaseNode::getSubscriptionTracker() {
+    if(!subscriptionTracker) {
+        subscriptionTracker = dai::ros::SubscriptionTracker::getInstance(getROSNode()->get_node_graph_interface());
+    }
+    return subscriptionTracker;
+}
+
+std::shared_ptr<PublisherCache> BaseNode::getPublisherCache() {
+    if(!publisherCache) {
+        publisherCache = PublisherCache::getInstance(getROSNode());
+    }
+    return publisherCache;
+}
+
+image_transport::CameraPublisher BaseNode::getCameraPublisher(const std::string& topic) {
+    return getPublisherCache()->getCameraPublisher(topic);
+}
+
 std::string BaseNode::getTFPrefix(const std::string& frameName) {
     return std::string(getROSNode()->get_name()) + "_" + frameName;
 }
@@ -61,5 +80,13 @@ void BaseNode::link(dai::Node::Input /*in*/, int /*linkType = 0*/) {
 void BaseNode::updateParams(const std::vector<rclcpp::Parameter>& /*params*/) {
     return;
 };
+
+void BaseNode::activate() {
+    return;
+};
+
+void BaseNode::deactivate() {
+    return;
+};
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
\ No newline at end of file
@@ -56,7 +56,7 @@ void Segmentation::setXinXout(std::shared_ptr<dai::Pipeline> pipeline) {
 
 void Segmentation::setupQueues(std::shared_ptr<dai::Device> device) {
     nnQ = device->getOutputQueue(nnQName, ph->getParam<int>("i_max_q_size"), false);
-    nnPub = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/image_raw");
+    nnPub = getCameraPublisher("~/" + getName() + "/image_raw");
     nnQ->addCallback(std::bind(&Segmentation::segmentationCB, this, std::placeholders::_1, std::placeholders::_2));
     if(ph->getParam<bool>("i_enable_passthrough")) {
         auto tfPrefix = getTFPrefix(utils::getSocketName(static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id"))));
@@ -71,8 +71,14 @@ void Segmentation::setupQueues(std::shared_ptr<dai::Device> device) {
                                                                 imageManip->initialConfig.getResizeWidth(),
                                                                 imageManip->initialConfig.getResizeWidth()));
 
-        ptPub = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/passthrough/image_raw");
-        ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub, std::placeholders::_1, std::placeholders::_2, *imageConverter, ptPub, infoManager));
+        ptPub = getCameraPublisher("~/" + getName() + "/passthrough/image_raw");
+        ptQ->addCallback(std::bind(sensor_helpers::basicCameraPub,
+                                   std::placeholders::_1,
+                                   std::placeholders::_2,
+                                   *imageConverter,
+                                   ptPub,
+                                   infoManager,
+                                   getSubscriptionTracker()->track(ptPub)));
     }
 }
 
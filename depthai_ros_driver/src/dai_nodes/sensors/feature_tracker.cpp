@@ -6,6 +6,7 @@
 #include "depthai/pipeline/node/FeatureTracker.hpp"
 #include "depthai/pipeline/node/XLinkOut.hpp"
 #include "depthai_bridge/TrackedFeaturesConverter.hpp"
+#include "depthai_ros_driver/dai_nodes/sensors/sensor_helpers.hpp"
 #include "depthai_ros_driver/param_handlers/feature_tracker_param_handler.hpp"
 #include "depthai_ros_driver/utils.hpp"
 #include "depthai_ros_msgs/msg/tracked_features.hpp"
@@ -47,10 +48,15 @@ void FeatureTracker::setupQueues(std::shared_ptr<dai::Device> device) {
     rclcpp::PublisherOptions options;
     options.qos_overriding_options = rclcpp::QosOverridingOptions();
     featureConverter = std::make_unique<dai::ros::TrackedFeaturesConverter>(tfPrefix + "_frame", ph->getParam<bool>("i_get_base_device_timestamp"));
-    featureConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+    featureConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
 
-    featurePub = getROSNode()->create_publisher<depthai_ros_msgs::msg::TrackedFeatures>("~/" + getName() + "/tracked_features", 10, options);
-    featureQ->addCallback(std::bind(&FeatureTracker::featureQCB, this, std::placeholders::_1, std::placeholders::_2));
+    if(ph->getParam<bool>("i_publish_packed")) {
+        packedFeaturePub = getPublisher<depthai_ros_msgs::msg::PackedTrackedFeatures>("~/" + getName() + "/tracked_features_packed", 10, options);
+        featureQ->addCallback(std::bind(&FeatureTracker::packedFeatureQCB, this, std::placeholders::_1, std::placeholders::_2));
+    } else {
+        featurePub = getPublisher<depthai_ros_msgs::msg::TrackedFeatures>("~/" + getName() + "/tracked_features", 10, options);
+        featureQ->addCallback(std::bind(&FeatureTracker::featureQCB, this, std::placeholders::_1, std::placeholders::_2));
+    }
 }
 
 void FeatureTracker::closeQueues() {
@@ -62,12 +68,17 @@ void FeatureTracker::featureQCB(const std::string& /*name*/, const std::shared_p
     std::deque<depthai_ros_msgs::msg::TrackedFeatures> deq;
     featureConverter->toRosMsg(featureData, deq);
     while(deq.size() > 0) {
-        auto currMsg = deq.front();
-        featurePub->publish(currMsg);
+        featurePub->publish(deq.front());
         deq.pop_front();
     }
 }
 
+void FeatureTracker::packedFeatureQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    auto featureData = std::dynamic_pointer_cast<dai::TrackedFeatures>(data);
+    featureConverter->toRosPackedMsgInPlace(featureData, packedFeatureMsg);
+    sensor_helpers::publishReused(packedFeaturePub, packedFeatureMsg);
+}
+
 void FeatureTracker::link(dai::Node::Input in, int /*linkType*/) {
     featureNode->outputFeatures.link(in);
 }
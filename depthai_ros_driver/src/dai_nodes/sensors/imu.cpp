@@ -8,6 +8,7 @@
 #include "depthai_bridge/ImuConverter.hpp"
 #include "depthai_ros_driver/param_handlers/imu_param_handler.hpp"
 #include "depthai_ros_driver/utils.hpp"
+#include "depthai_ros_msgs/msg/imu_batch.hpp"
 #include "depthai_ros_msgs/msg/imu_with_magnetic_field.hpp"
 #include "rclcpp/node.hpp"
 
@@ -51,55 +52,86 @@ void Imu::setupQueues(std::shared_ptr<dai::Device> device) {
                                                             ph->getParam<bool>("i_enable_rotation"),
                                                             enableMagn,
                                                             ph->getParam<bool>("i_get_base_device_timestamp"));
-    imuConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+    imuConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
+    imuConverter->setSensorRates(ph->getParam<int>("i_acc_freq"), ph->getParam<int>("i_gyro_freq"));
+    bool publishBatch = ph->getParam<bool>("i_publish_batch");
     switch(msgType) {
         case param_handlers::imu::ImuMsgType::IMU: {
-            rosImuPub = getROSNode()->create_publisher<sensor_msgs::msg::Imu>("~/" + getName() + "/data", 10, options);
-            imuQ->addCallback(std::bind(&Imu::imuRosQCB, this, std::placeholders::_1, std::placeholders::_2));
+            rosImuPub = getPublisher<sensor_msgs::msg::Imu>("~/" + getName() + "/data", 10, options);
+            if(!publishBatch) {
+                imuQ->addCallback(std::bind(&Imu::imuRosQCB, this, std::placeholders::_1, std::placeholders::_2));
+            }
             break;
         }
         case param_handlers::imu::ImuMsgType::IMU_WITH_MAG: {
-            daiImuPub = getROSNode()->create_publisher<depthai_ros_msgs::msg::ImuWithMagneticField>("~/" + getName() + "/data", 10, options);
-            imuQ->addCallback(std::bind(&Imu::imuDaiRosQCB, this, std::placeholders::_1, std::placeholders::_2));
+            daiImuPub = getPublisher<depthai_ros_msgs::msg::ImuWithMagneticField>("~/" + getName() + "/data", 10, options);
+            if(!publishBatch) {
+                imuQ->addCallback(std::bind(&Imu::imuDaiRosQCB, this, std::placeholders::_1, std::placeholders::_2));
+            }
             break;
         }
         case param_handlers::imu::ImuMsgType::IMU_WITH_MAG_SPLIT: {
-            rosImuPub = getROSNode()->create_publisher<sensor_msgs::msg::Imu>("~/" + getName() + "/data", 10, options);
-            magPub = getROSNode()->create_publisher<sensor_msgs::msg::MagneticField>("~/" + getName() + "/mag", 10, options);
-            imuQ->addCallback(std::bind(&Imu::imuMagQCB, this, std::placeholders::_1, std::placeholders::_2));
+            rosImuPub = getPublisher<sensor_msgs::msg::Imu>("~/" + getName() + "/data", 10, options);
+            magPub = getPublisher<sensor_msgs::msg::MagneticField>("~/" + getName() + "/mag", 10, options);
+            if(!publishBatch) {
+                imuQ->addCallback(std::bind(&Imu::imuMagQCB, this, std::placeholders::_1, std::placeholders::_2));
+            }
             break;
         }
         default: {
             break;
         }
     }
+    if(publishBatch) {
+        batchPub = getPublisher<depthai_ros_msgs::msg::ImuBatch>("~/" + getName() + "/batch", 10, options);
+        imuSubscribed = daiImuPub ? getSubscriptionTracker()->track(daiImuPub) : getSubscriptionTracker()->track(rosImuPub);
+        if(magPub) {
+            magSubscribed = getSubscriptionTracker()->track(magPub);
+        }
+        imuQ->addCallback(std::bind(&Imu::imuBatchQCB, this, std::placeholders::_1, std::placeholders::_2));
+    }
 }
 
 void Imu::closeQueues() {
     imuQ->close();
 }
 
+void Imu::activate() {
+    active = true;
+}
+
+void Imu::deactivate() {
+    active = false;
+}
+
 void Imu::imuRosQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    if(!active) {
+        return;
+    }
     auto imuData = std::dynamic_pointer_cast<dai::IMUData>(data);
     std::deque<sensor_msgs::msg::Imu> deq;
     imuConverter->toRosMsg(imuData, deq);
     while(deq.size() > 0) {
-        auto currMsg = deq.front();
-        rosImuPub->publish(currMsg);
+        rosImuPub->publish(std::make_unique<sensor_msgs::msg::Imu>(std::move(deq.front())));
         deq.pop_front();
     }
 }
 void Imu::imuDaiRosQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    if(!active) {
+        return;
+    }
     auto imuData = std::dynamic_pointer_cast<dai::IMUData>(data);
     std::deque<depthai_ros_msgs::msg::ImuWithMagneticField> deq;
     imuConverter->toRosDaiMsg(imuData, deq);
     while(deq.size() > 0) {
-        auto currMsg = deq.front();
-        daiImuPub->publish(currMsg);
+        daiImuPub->publish(std::make_unique<depthai_ros_msgs::msg::ImuWithMagneticField>(std::move(deq.front())));
         deq.pop_front();
     }
 }
 void Imu::imuMagQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    if(!active) {
+        return;
+    }
     auto imuData = std::dynamic_pointer_cast<dai::IMUData>(data);
     std::deque<depthai_ros_msgs::msg::ImuWithMagneticField> deq;
     imuConverter->toRosDaiMsg(imuData, deq);
@@ -114,6 +146,43 @@ void Imu::imuMagQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADat
         deq.pop_front();
     }
 }
+void Imu::imuBatchQCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    if(!active) {
+        return;
+    }
+    auto imuData = std::dynamic_pointer_cast<dai::IMUData>(data);
+    auto batch = std::make_unique<depthai_ros_msgs::msg::ImuBatch>();
+    imuConverter->toRosBatchMsg(imuData, *batch);
+    if(batch->imu.empty()) {
+        return;
+    }
+    if(daiImuPub) {
+        if(imuSubscribed->load(std::memory_order_relaxed)) {
+            for(size_t i = 0; i < batch->imu.size(); i++) {
+                auto msg = std::make_unique<depthai_ros_msgs::msg::ImuWithMagneticField>();
+                msg->header = batch->imu[i].header;
+                msg->imu = batch->imu[i];
+                if(i < batch->field.size()) {
+                    msg->field = batch->field[i];
+                }
+                daiImuPub->publish(std::move(msg));
+            }
+        }
+    } else {
+        if(imuSubscribed->load(std::memory_order_relaxed)) {
+            for(const auto& imu : batch->imu) {
+                rosImuPub->publish(std::make_unique<sensor_msgs::msg::Imu>(imu));
+            }
+        }
+        if(magPub && magSubscribed->load(std::memory_order_relaxed)) {
+            for(const auto& field : batch->field) {
+                magPub->publish(std::make_unique<sensor_msgs::msg::MagneticField>(field));
+            }
+        }
+    }
+    batchPub->publish(std::move(batch));
+}
+
 void Imu::link(dai::Node::Input in, int /*linkType*/) {
     imuNode->out.link(in);
 }
@@ -44,7 +44,12 @@ void Mono::setXinXout(std::shared_ptr<dai::Pipeline> pipeline) {
         xoutMono = pipeline->create<dai::node::XLinkOut>();
         xoutMono->setStreamName(monoQName);
         if(ph->getParam<bool>("i_low_bandwidth")) {
-            videoEnc = sensor_helpers::createEncoder(pipeline, ph->getParam<int>("i_low_bandwidth_quality"));
+            videoEnc = sensor_helpers::createEncoder(pipeline,
+                                                     ph->getParam<int>("i_low_bandwidth_quality"),
+                                                     utils::getValFromMap(ph->getParam<std::string>("i_low_bandwidth_profile"),
+                                                                          sensor_helpers::encoderProfileMap),
+                                                     ph->getParam<int>("i_low_bandwidth_bitrate"),
+                                                     ph->getParam<int>("i_low_bandwidth_frame_freq"));
             monoCamNode->out.link(videoEnc->input);
             videoEnc->bitstream.link(xoutMono->input);
         } else {
@@ -61,9 +66,13 @@ void Mono::setupQueues(std::shared_ptr<dai::Device> device) {
         auto tfPrefix = getTFPrefix(utils::getSocketName(static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id"))));
         imageConverter =
             std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false, ph->getParam<bool>("i_get_base_device_timestamp"));
-        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
+        int decodeScale = 1;
         if(ph->getParam<bool>("i_low_bandwidth")) {
-            imageConverter->convertFromBitstream(dai::RawImgFrame::Type::GRAY8);
+            imageConverter->convertFromBitstream(dai::RawImgFrame::Type::GRAY8,
+                                                 utils::getValFromMap(ph->getParam<std::string>("i_low_bandwidth_profile"), sensor_helpers::encoderProfileMap));
+            decodeScale = ph->getParam<int>("i_low_bandwidth_decode_scale");
+            imageConverter->setDecodeScale(decodeScale);
         }
         if(ph->getParam<bool>("i_add_exposure_offset")) {
             auto offset = static_cast<dai::CameraExposureOffset>(ph->getParam<int>("i_exposure_offset"));
@@ -79,16 +88,53 @@ void Mono::setupQueues(std::shared_ptr<dai::Device> device) {
                                                                     *imageConverter,
                                                                     device,
                                                                     static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id")),
-                                                                    ph->getParam<int>("i_width"),
-                                                                    ph->getParam<int>("i_height")));
+                                                                    (ph->getParam<int>("i_width") + decodeScale - 1) / decodeScale,
+                                                                    (ph->getParam<int>("i_height") + decodeScale - 1) / decodeScale));
         } else {
             infoManager->loadCameraInfo(ph->getParam<std::string>("i_calibration_file"));
         }
         monoQ = device->getOutputQueue(monoQName, ph->getParam<int>("i_max_q_size"), false);
-        if(ipcEnabled()) {
+        if(ph->getParam<bool>("i_low_bandwidth") && ph->getParam<std::string>("i_low_bandwidth_profile") != "MJPEG") {
+            // H.264/H.265 frames always go out as packets, raw images need the software decoder in the bridge.
+            if(!dai::ros::VideoDecoder::isAvailable()) {
+                RCLCPP_WARN(getROSNode()->get_logger(), "depthai_bridge was built without libavcodec, %s only publishes encoded packets.", getName().c_str());
+            }
+            monoPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            packetPub = getPublisher<depthai_ros_msgs::msg::FFMPEGPacket>("~/" + getName() + "/encoded", 10);
+            infoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+            monoQ->addCallback(std::bind(sensor_helpers::videoPub,
+                                         std::placeholders::_1,
+                                         std::placeholders::_2,
+                                         *imageConverter,
+                                         monoPub,
+                                         packetPub,
+                                         infoPub,
+                                         infoManager,
+                                         getSubscriptionTracker()->track(monoPub),
+                                         getSubscriptionTracker()->track(packetPub),
+                                         getSubscriptionTracker()->track(infoPub),
+                                         ph->getParam<bool>("i_enable_lazy_publisher")));
+        } else if(ph->getParam<bool>("i_low_bandwidth") && ph->getParam<bool>("i_low_bandwidth_passthrough")) {
+            // Bitstream goes out as is on the compressed transport topic, raw images are only decoded on demand.
+            monoPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            compressedPub = getPublisher<sensor_msgs::msg::CompressedImage>("~/" + getName() + "/image_raw/compressed", 10);
+            infoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+            monoQ->addCallback(std::bind(sensor_helpers::compressedPub,
+                                         std::placeholders::_1,
+                                         std::placeholders::_2,
+                                         *imageConverter,
+                                         monoPub,
+                                         compressedPub,
+                                         infoPub,
+                                         infoManager,
+                                         getSubscriptionTracker()->track(monoPub),
+                                         getSubscriptionTracker()->track(compressedPub),
+                                         getSubscriptionTracker()->track(infoPub),
+                                         ph->getParam<bool>("i_enable_lazy_publisher")));
+        } else if(ipcEnabled()) {
             RCLCPP_DEBUG(getROSNode()->get_logger(), "Enabling intra_process communication!");
-            monoPub = getROSNode()->create_publisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
-            infoPub = getROSNode()->create_publisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+            monoPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            infoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
             monoQ->addCallback(std::bind(sensor_helpers::splitPub,
                                          std::placeholders::_1,
                                          std::placeholders::_2,
@@ -96,16 +142,18 @@ void Mono::setupQueues(std::shared_ptr<dai::Device> device) {
                                          monoPub,
                                          infoPub,
                                          infoManager,
+                                         sensor_helpers::trackSubscription(*getSubscriptionTracker(), monoPub, infoPub),
                                          ph->getParam<bool>("i_enable_lazy_publisher")));
 
         } else {
-            monoPubIT = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/image_raw");
+            monoPubIT = getCameraPublisher("~/" + getName() + "/image_raw");
             monoQ->addCallback(std::bind(sensor_helpers::cameraPub,
                                          std::placeholders::_1,
                                          std::placeholders::_2,
                                          *imageConverter,
                                          monoPubIT,
                                          infoManager,
+                                         getSubscriptionTracker()->track(monoPubIT),
                                          ph->getParam<bool>("i_enable_lazy_publisher")));
         }
     }
@@ -127,5 +175,18 @@ void Mono::updateParams(const std::vector<rclcpp::Parameter>& params) {
     controlQ->send(ctrl);
 }
 
+void Mono::activate() {
+    dai::CameraControl ctrl;
+    ctrl.setStartStreaming();
+    controlQ->send(ctrl);
+}
+
+void Mono::deactivate() {
+    // Stopped sensors produce no frames, so nothing downstream runs or gets sent over XLink.
+    dai::CameraControl ctrl;
+    ctrl.setStopStreaming();
+    controlQ->send(ctrl);
+}
+
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
@@ -45,7 +45,12 @@ void RGB::setXinXout(std::shared_ptr<dai::Pipeline> pipeline) {
         xoutColor = pipeline->create<dai::node::XLinkOut>();
         xoutColor->setStreamName(ispQName);
         if(ph->getParam<bool>("i_low_bandwidth")) {
-            videoEnc = sensor_helpers::createEncoder(pipeline, ph->getParam<int>("i_low_bandwidth_quality"));
+            videoEnc = sensor_helpers::createEncoder(pipeline,
+                                                     ph->getParam<int>("i_low_bandwidth_quality"),
+                                                     utils::getValFromMap(ph->getParam<std::string>("i_low_bandwidth_profile"),
+                                                                          sensor_helpers::encoderProfileMap),
+                                                     ph->getParam<int>("i_low_bandwidth_bitrate"),
+                                                     ph->getParam<int>("i_low_bandwidth_frame_freq"));
             colorCamNode->video.link(videoEnc->input);
             videoEnc->bitstream.link(xoutColor->input);
         } else {
@@ -74,9 +79,15 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
             getROSNode()->create_sub_node(std::string(getROSNode()->get_name()) + "/" + getName()).get(), "/" + getName());
         imageConverter =
             std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false, ph->getParam<bool>("i_get_base_device_timestamp"));
-        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
+        // ISP output is YUV420p and video output NV12, both can go out without conversion to bgr8.
+        imageConverter->setNativeYUV(ph->getParam<bool>("i_publish_native_yuv"));
+        int decodeScale = 1;
         if(ph->getParam<bool>("i_low_bandwidth")) {
-            imageConverter->convertFromBitstream(dai::RawImgFrame::Type::BGR888i);
+            imageConverter->convertFromBitstream(dai::RawImgFrame::Type::BGR888i,
+                                                 utils::getValFromMap(ph->getParam<std::string>("i_low_bandwidth_profile"), sensor_helpers::encoderProfileMap));
+            decodeScale = ph->getParam<int>("i_low_bandwidth_decode_scale");
+            imageConverter->setDecodeScale(decodeScale);
         }
         if(ph->getParam<bool>("i_add_exposure_offset")) {
             auto offset = static_cast<dai::CameraExposureOffset>(ph->getParam<int>("i_exposure_offset"));
@@ -92,15 +103,52 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
                                                                     *imageConverter,
                                                                     device,
                                                                     static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id")),
-                                                                    ph->getParam<int>("i_width"),
-                                                                    ph->getParam<int>("i_height")));
+                                                                    (ph->getParam<int>("i_width") + decodeScale - 1) / decodeScale,
+                                                                    (ph->getParam<int>("i_height") + decodeScale - 1) / decodeScale));
         } else {
             infoManager->loadCameraInfo(ph->getParam<std::string>("i_calibration_file"));
         }
         colorQ = device->getOutputQueue(ispQName, ph->getParam<int>("i_max_q_size"), false);
-        if(ipcEnabled()) {
-            rgbPub = getROSNode()->create_publisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
-            rgbInfoPub = getROSNode()->create_publisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+        if(ph->getParam<bool>("i_low_bandwidth") && ph->getParam<std::string>("i_low_bandwidth_profile") != "MJPEG") {
+            // H.264/H.265 frames always go out as packets, raw images need the software decoder in the bridge.
+            if(!dai::ros::VideoDecoder::isAvailable()) {
+                RCLCPP_WARN(getROSNode()->get_logger(), "depthai_bridge was built without libavcodec, %s only publishes encoded packets.", getName().c_str());
+            }
+            rgbPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            rgbPacketPub = getPublisher<depthai_ros_msgs::msg::FFMPEGPacket>("~/" + getName() + "/encoded", 10);
+            rgbInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+            colorQ->addCallback(std::bind(sensor_helpers::videoPub,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2,
+                                          *imageConverter,
+                                          rgbPub,
+                                          rgbPacketPub,
+                                          rgbInfoPub,
+                                          infoManager,
+                                          getSubscriptionTracker()->track(rgbPub),
+                                          getSubscriptionTracker()->track(rgbPacketPub),
+                                          getSubscriptionTracker()->track(rgbInfoPub),
+                                          ph->getParam<bool>("i_enable_lazy_publisher")));
+        } else if(ph->getParam<bool>("i_low_bandwidth") && ph->getParam<bool>("i_low_bandwidth_passthrough")) {
+            // Bitstream goes out as is on the compressed transport topic, raw images are only decoded on demand.
+            rgbPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            rgbCompressedPub = getPublisher<sensor_msgs::msg::CompressedImage>("~/" + getName() + "/image_raw/compressed", 10);
+            rgbInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+            colorQ->addCallback(std::bind(sensor_helpers::compressedPub,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2,
+                                          *imageConverter,
+                                          rgbPub,
+                                          rgbCompressedPub,
+                                          rgbInfoPub,
+                                          infoManager,
+                                          getSubscriptionTracker()->track(rgbPub),
+                                          getSubscriptionTracker()->track(rgbCompressedPub),
+                                          getSubscriptionTracker()->track(rgbInfoPub),
+                                          ph->getParam<bool>("i_enable_lazy_publisher")));
+        } else if(ipcEnabled()) {
+            rgbPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+            rgbInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
             colorQ->addCallback(std::bind(sensor_helpers::splitPub,
                                           std::placeholders::_1,
                                           std::placeholders::_2,
@@ -108,16 +156,18 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
                                           rgbPub,
                                           rgbInfoPub,
                                           infoManager,
+                                          sensor_helpers::trackSubscription(*getSubscriptionTracker(), rgbPub, rgbInfoPub),
                                           ph->getParam<bool>("i_enable_lazy_publisher")));
 
         } else {
-            rgbPubIT = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/image_raw");
+            rgbPubIT = getCameraPublisher("~/" + getName() + "/image_raw");
             colorQ->addCallback(std::bind(sensor_helpers::cameraPub,
                                           std::placeholders::_1,
                                           std::placeholders::_2,
                                           *imageConverter,
                                           rgbPubIT,
                                           infoManager,
+                                          getSubscriptionTracker()->track(rgbPubIT),
                                           ph->getParam<bool>("i_enable_lazy_publisher")));
         }
     }
@@ -128,7 +178,7 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
             getROSNode()->create_sub_node(std::string(getROSNode()->get_name()) + "/" + previewQName).get(), previewQName);
         auto tfPrefix = getTFPrefix(utils::getSocketName(static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id"))));
         imageConverter = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false);
-        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+        imageConverter->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
         if(ph->getParam<std::string>("i_calibration_file").empty()) {
             previewInfoManager->setCameraInfo(sensor_helpers::getCalibInfo(getROSNode()->get_logger(),
                                                                            *imageConverter,
@@ -140,12 +190,17 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
             previewInfoManager->loadCameraInfo(ph->getParam<std::string>("i_calibration_file"));
         }
         if(ipcEnabled()) {
-            previewPubIT = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/preview/image_raw");
-            previewQ->addCallback(
-                std::bind(sensor_helpers::basicCameraPub, std::placeholders::_1, std::placeholders::_2, *imageConverter, previewPubIT, previewInfoManager));
+            previewPubIT = getCameraPublisher("~/" + getName() + "/preview/image_raw");
+            previewQ->addCallback(std::bind(sensor_helpers::basicCameraPub,
+                                            std::placeholders::_1,
+                                            std::placeholders::_2,
+                                            *imageConverter,
+                                            previewPubIT,
+                                            previewInfoManager,
+                                            getSubscriptionTracker()->track(previewPubIT)));
         } else {
-            previewPub = getROSNode()->create_publisher<sensor_msgs::msg::Image>("~/" + getName() + "/preview/image_raw", 10);
-            previewInfoPub = getROSNode()->create_publisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/preview/camera_info", 10);
+            previewPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/preview/image_raw", 10);
+            previewInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/preview/camera_info", 10);
             previewQ->addCallback(std::bind(sensor_helpers::splitPub,
                                             std::placeholders::_1,
                                             std::placeholders::_2,
@@ -153,6 +208,7 @@ void RGB::setupQueues(std::shared_ptr<dai::Device> device) {
                                             previewPub,
                                             previewInfoPub,
                                             previewInfoManager,
+                                            sensor_helpers::trackSubscription(*getSubscriptionTracker(), previewPub, previewInfoPub),
                                             ph->getParam<bool>("i_enable_lazy_publisher")));
         }
     };
@@ -186,5 +242,18 @@ void RGB::updateParams(const std::vector<rclcpp::Parameter>& params) {
     controlQ->send(ctrl);
 }
 
+void RGB::activate() {
+    dai::CameraControl ctrl;
+    ctrl.setStartStreaming();
+    controlQ->send(ctrl);
+}
+
+void RGB::deactivate() {
+    // Stopped sensors produce no frames, so nothing downstream runs or gets sent over XLink.
+    dai::CameraControl ctrl;
+    ctrl.setStopStreaming();
+    controlQ->send(ctrl);
+}
+
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
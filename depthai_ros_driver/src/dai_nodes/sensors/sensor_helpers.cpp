@@ -1,6 +1,11 @@
 #include "depthai_ros_driver/dai_nodes/sensors/sensor_helpers.hpp"
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 #include "camera_info_manager/camera_info_manager.hpp"
+#include "depthai/device/Device.hpp"
 #include "depthai/pipeline/Pipeline.hpp"
 #include "depthai/pipeline/node/VideoEncoder.hpp"
 #include "depthai_bridge/ImageConverter.hpp"
@@ -65,18 +70,26 @@ const std::unordered_map<std::string, dai::CameraImageOrientation> cameraImageOr
     {"HORIZONTAL_MIRROR", dai::CameraImageOrientation::HORIZONTAL_MIRROR},
     {"VERTICAL_FLIP", dai::CameraImageOrientation::VERTICAL_FLIP},
 };
+const std::unordered_map<std::string, dai::VideoEncoderProperties::Profile> encoderProfileMap = {
+    {"MJPEG", dai::VideoEncoderProperties::Profile::MJPEG},
+    {"H264_BASELINE", dai::VideoEncoderProperties::Profile::H264_BASELINE},
+    {"H264_MAIN", dai::VideoEncoderProperties::Profile::H264_MAIN},
+    {"H264_HIGH", dai::VideoEncoderProperties::Profile::H264_HIGH},
+    {"H265_MAIN", dai::VideoEncoderProperties::Profile::H265_MAIN},
+};
 
 void basicCameraPub(const std::string& /*name*/,
                     const std::shared_ptr<dai::ADatatype>& data,
                     dai::ros::ImageConverter& converter,
                     image_transport::CameraPublisher& pub,
-                    std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager) {
-    if(rclcpp::ok() && (pub.getNumSubscribers() > 0)) {
+                    std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+                    dai::ros::SubscriptionTracker::Flag subscribed) {
+    if(rclcpp::ok() && subscribed->load(std::memory_order_relaxed)) {
         auto img = std::dynamic_pointer_cast<dai::ImgFrame>(data);
-        auto info = infoManager->getCameraInfo();
-        auto rawMsg = converter.toRosMsgRawPtr(img);
-        info.header = rawMsg.header;
-        pub.publish(rawMsg, info);
+        auto info = std::make_shared<sensor_msgs::msg::CameraInfo>(infoManager->getCameraInfo());
+        sensor_msgs::msg::Image::ConstSharedPtr msg = converter.toRosMsgUniquePtr(img);
+        info->header = msg->header;
+        pub.publish(msg, info);
     }
 }
 
@@ -85,13 +98,14 @@ void cameraPub(const std::string& /*name*/,
                dai::ros::ImageConverter& converter,
                image_transport::CameraPublisher& pub,
                std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+               dai::ros::SubscriptionTracker::Flag subscribed,
                bool lazyPub) {
-    if(rclcpp::ok() && (!lazyPub || pub.getNumSubscribers() > 0)) {
+    if(rclcpp::ok() && (!lazyPub || subscribed->load(std::memory_order_relaxed))) {
         auto img = std::dynamic_pointer_cast<dai::ImgFrame>(data);
-        auto info = infoManager->getCameraInfo();
-        auto rawMsg = converter.toRosMsgRawPtr(img, info);
-        info.header = rawMsg.header;
-        pub.publish(rawMsg, info);
+        auto info = std::make_shared<sensor_msgs::msg::CameraInfo>(infoManager->getCameraInfo());
+        sensor_msgs::msg::Image::ConstSharedPtr msg = converter.toRosMsgUniquePtr(img, *info);
+        info->header = msg->header;
+        pub.publish(msg, info);
     }
 }
 
@@ -101,38 +115,190 @@ void splitPub(const std::string& /*name*/,
               rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
               rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
               std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+              dai::ros::SubscriptionTracker::Flag subscribed,
               bool lazyPub) {
-    if(rclcpp::ok() && (!lazyPub || detectSubscription(imgPub, infoPub))) {
+    if(rclcpp::ok() && (!lazyPub || subscribed->load(std::memory_order_relaxed))) {
         auto img = std::dynamic_pointer_cast<dai::ImgFrame>(data);
-        auto info = infoManager->getCameraInfo();
-        auto rawMsg = converter.toRosMsgRawPtr(img, info);
-        info.header = rawMsg.header;
-        sensor_msgs::msg::CameraInfo::UniquePtr infoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(info);
-        sensor_msgs::msg::Image::UniquePtr msg = std::make_unique<sensor_msgs::msg::Image>(rawMsg);
+        sensor_msgs::msg::CameraInfo::UniquePtr infoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(infoManager->getCameraInfo());
+        sensor_msgs::msg::Image::UniquePtr msg = converter.toRosMsgUniquePtr(img, *infoMsg);
+        infoMsg->header = msg->header;
+        imgPub->publish(std::move(msg));
+        infoPub->publish(std::move(infoMsg));
+    }
+}
+
+void compressedPub(const std::string& /*name*/,
+                   const std::shared_ptr<dai::ADatatype>& data,
+                   dai::ros::ImageConverter& converter,
+                   rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
+                   rclcpp::Publisher<sensor_msgs::msg::CompressedImage>::SharedPtr compressedPub,
+                   rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+                   std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+                   dai::ros::SubscriptionTracker::Flag rawSubscribed,
+                   dai::ros::SubscriptionTracker::Flag compressedSubscribed,
+                   dai::ros::SubscriptionTracker::Flag infoSubscribed,
+                   bool lazyPub) {
+    if(!rclcpp::ok()) {
+        return;
+    }
+    bool rawSub = !lazyPub || rawSubscribed->load(std::memory_order_relaxed);
+    bool compressedSub = !lazyPub || compressedSubscribed->load(std::memory_order_relaxed);
+    bool infoSub = !lazyPub || infoSubscribed->load(std::memory_order_relaxed);
+    if(!rawSub && !compressedSub && !infoSub) {
+        return;
+    }
+    auto img = std::dynamic_pointer_cast<dai::ImgFrame>(data);
+    sensor_msgs::msg::CameraInfo::UniquePtr infoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(infoManager->getCameraInfo());
+    // Raw conversion has to run first, the compressed message takes over the bitstream buffer.
+    if(rawSub) {
+        sensor_msgs::msg::Image::UniquePtr msg = converter.toRosMsgUniquePtr(img, *infoMsg);
+        infoMsg->header = msg->header;
         imgPub->publish(std::move(msg));
+    }
+    if(compressedSub || !rawSub) {
+        sensor_msgs::msg::CompressedImage::UniquePtr compressedMsg = converter.toRosCompressedMsg(img);
+        if(rawSub) {
+            compressedMsg->header = infoMsg->header;
+        } else {
+            infoMsg->header = compressedMsg->header;
+        }
+        if(compressedSub) {
+            compressedPub->publish(std::move(compressedMsg));
+        }
+    }
+    if(infoSub) {
         infoPub->publish(std::move(infoMsg));
     }
 }
 
+void videoPub(const std::string& /*name*/,
+              const std::shared_ptr<dai::ADatatype>& data,
+              dai::ros::ImageConverter& converter,
+              rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr imgPub,
+              rclcpp::Publisher<depthai_ros_msgs::msg::FFMPEGPacket>::SharedPtr packetPub,
+              rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+              std::shared_ptr<camera_info_manager::CameraInfoManager> infoManager,
+              dai::ros::SubscriptionTracker::Flag rawSubscribed,
+              dai::ros::SubscriptionTracker::Flag packetSubscribed,
+              dai::ros::SubscriptionTracker::Flag infoSubscribed,
+              bool lazyPub) {
+    if(!rclcpp::ok()) {
+        return;
+    }
+    bool rawSub = dai::ros::VideoDecoder::isAvailable() && (!lazyPub || rawSubscribed->load(std::memory_order_relaxed));
+    bool packetSub = !lazyPub || packetSubscribed->load(std::memory_order_relaxed);
+    bool infoSub = !lazyPub || infoSubscribed->load(std::memory_order_relaxed);
+    if(!rawSub && !packetSub && !infoSub) {
+        return;
+    }
+    auto img = std::dynamic_pointer_cast<dai::ImgFrame>(data);
+    sensor_msgs::msg::CameraInfo::UniquePtr infoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(infoManager->getCameraInfo());
+    // Raw conversion has to run first, the packet takes over the bitstream buffer.
+    sensor_msgs::msg::Image::UniquePtr msg;
+    if(rawSub) {
+        msg = converter.toRosMsgUniquePtr(img, *infoMsg);
+    }
+    // No image while the decoder waits for a keyframe, the packet header is used for camera_info then.
+    bool decoded = msg != nullptr;
+    if(decoded) {
+        infoMsg->header = msg->header;
+        imgPub->publish(std::move(msg));
+    }
+    if(packetSub || !decoded) {
+        depthai_ros_msgs::msg::FFMPEGPacket::UniquePtr packetMsg = converter.toRosFFMPEGPacket(img);
+        if(decoded) {
+            packetMsg->header = infoMsg->header;
+        } else {
+            infoMsg->header = packetMsg->header;
+        }
+        if(packetSub) {
+            packetPub->publish(std::move(packetMsg));
+        }
+    }
+    if(infoSub) {
+        infoPub->publish(std::move(infoMsg));
+    }
+}
+
+namespace {
+// mxId, socket, width, height, alpha scaling enabled, alpha scaling factor, reversed stereo socket order
+using CalibInfoKey = std::tuple<std::string, int, int, int, bool, double, bool>;
+std::mutex calibCacheMutex;
+std::unordered_map<std::string, dai::CalibrationHandler> calibHandlerCache;
+std::map<CalibInfoKey, sensor_msgs::msg::CameraInfo> calibInfoCache;
+}  // namespace
+
+dai::CalibrationHandler getCalibHandler(std::shared_ptr<dai::Device> device) {
+    // Reading calibration is a device RPC parsing the whole EEPROM, so do it once per device.
+    std::lock_guard<std::mutex> lock(calibCacheMutex);
+    auto mxId = device->getMxId();
+    auto it = calibHandlerCache.find(mxId);
+    if(it == calibHandlerCache.end()) {
+        it = calibHandlerCache.emplace(mxId, device->readCalibration()).first;
+    }
+    return it->second;
+}
+
+void invalidateCalibCache(const std::string& mxId) {
+    std::lock_guard<std::mutex> lock(calibCacheMutex);
+    if(mxId.empty()) {
+        calibHandlerCache.clear();
+        calibInfoCache.clear();
+        return;
+    }
+    calibHandlerCache.erase(mxId);
+    for(auto it = calibInfoCache.begin(); it != calibInfoCache.end();) {
+        if(std::get<0>(it->first) == mxId) {
+            it = calibInfoCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 sensor_msgs::msg::CameraInfo getCalibInfo(const rclcpp::Logger& logger,
                                           dai::ros::ImageConverter& converter,
                                           std::shared_ptr<dai::Device> device,
                                           dai::CameraBoardSocket socket,
                                           int width,
                                           int height) {
+    CalibInfoKey key{device->getMxId(),
+                     static_cast<int>(socket),
+                     width,
+                     height,
+                     converter.isAlphaScalingEnabled(),
+                     converter.getAlphaScalingFactor(),
+                     converter.isStereoSocketOrderReversed()};
+    {
+        std::lock_guard<std::mutex> lock(calibCacheMutex);
+        auto it = calibInfoCache.find(key);
+        if(it != calibInfoCache.end()) {
+            return it->second;
+        }
+    }
     sensor_msgs::msg::CameraInfo info;
-    auto calibHandler = device->readCalibration();
+    auto calibHandler = getCalibHandler(device);
     try {
         info = converter.calibrationToCameraInfo(calibHandler, socket, width, height);
     } catch(std::runtime_error& e) {
         RCLCPP_ERROR(logger, "No calibration for socket %d! Publishing empty camera_info.", static_cast<int>(socket));
+        return info;
     }
+    std::lock_guard<std::mutex> lock(calibCacheMutex);
+    calibInfoCache.emplace(key, info);
     return info;
 }
-std::shared_ptr<dai::node::VideoEncoder> createEncoder(std::shared_ptr<dai::Pipeline> pipeline, int quality, dai::VideoEncoderProperties::Profile profile) {
+std::shared_ptr<dai::node::VideoEncoder> createEncoder(
+    std::shared_ptr<dai::Pipeline> pipeline, int quality, dai::VideoEncoderProperties::Profile profile, int bitrate, int keyframeFrequency) {
     auto enc = pipeline->create<dai::node::VideoEncoder>();
     enc->setQuality(quality);
     enc->setProfile(profile);
+    if(profile != dai::VideoEncoderProperties::Profile::MJPEG) {
+        enc->setKeyframeFrequency(keyframeFrequency);
+        if(bitrate > 0) {
+            enc->setBitrateKbps(bitrate);
+        }
+    }
     return enc;
 }
 
@@ -141,6 +307,18 @@ bool detectSubscription(const rclcpp::Publisher<sensor_msgs::msg::Image>::Shared
     return (pub->get_subscription_count() > 0 || pub->get_intra_process_subscription_count() > 0 || infoPub->get_subscription_count() > 0
             || infoPub->get_intra_process_subscription_count() > 0);
 }
+
+dai::ros::SubscriptionTracker::Flag trackSubscription(dai::ros::SubscriptionTracker& tracker,
+                                                      const rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr& pub,
+                                                      const rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr& infoPub) {
+    std::weak_ptr<rclcpp::Publisher<sensor_msgs::msg::Image>> weakPub = pub;
+    std::weak_ptr<rclcpp::Publisher<sensor_msgs::msg::CameraInfo>> weakInfoPub = infoPub;
+    return tracker.track([weakPub, weakInfoPub]() {
+        auto pub = weakPub.lock();
+        auto infoPub = weakInfoPub.lock();
+        return pub && infoPub && detectSubscription(pub, infoPub);
+    });
+}
 }  // namespace sensor_helpers
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
\ No newline at end of file
@@ -30,7 +30,8 @@ SensorWrapper::SensorWrapper(const std::string& daiNodeName,
             topicName = "~/" + getName() + "/input";
         }
         sub = node->create_subscription<sensor_msgs::msg::Image>(topicName, 10, std::bind(&SensorWrapper::subCB, this, std::placeholders::_1));
-        converter = std::make_unique<dai::ros::ImageConverter>(true);
+        // Planar input is what NN nodes expect, color frames are split into planes before being sent to the device.
+        converter = std::make_unique<dai::ros::ImageConverter>(!ph->getParam<bool>("i_simulate_planar"));
         setNames();
         setXinXout(pipeline);
         socketID = ph->getParam<int>("i_board_socket_id");
@@ -135,5 +136,17 @@ void SensorWrapper::updateParams(const std::vector<rclcpp::Parameter>& params) {
     sensorNode->updateParams(params);
 }
 
+void SensorWrapper::activate() {
+    if(!ph->getParam<bool>("i_disable_node")) {
+        sensorNode->activate();
+    }
+}
+
+void SensorWrapper::deactivate() {
+    if(!ph->getParam<bool>("i_disable_node")) {
+        sensorNode->deactivate();
+    }
+}
+
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
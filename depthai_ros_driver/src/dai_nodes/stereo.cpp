@@ -139,14 +139,15 @@ void Stereo::setupRectQueue(std::shared_ptr<dai::Device> device,
                             std::unique_ptr<dai::ros::ImageConverter>& conv,
                             std::shared_ptr<camera_info_manager::CameraInfoManager>& im,
                             std::shared_ptr<dai::DataOutputQueue>& q,
-                            rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr pub,
-                            rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr infoPub,
+                            rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr& pub,
+                            rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr& infoPub,
                             image_transport::CameraPublisher& pubIT,
+                            dai::ros::SubscriptionTracker::Flag& subscribed,
                             bool isLeft) {
     auto sensorName = utils::getSocketName(sensorInfo.socket);
     auto tfPrefix = getTFPrefix(sensorName);
     conv = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false, ph->getParam<bool>("i_get_base_device_timestamp"));
-    conv->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+    conv->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
     bool lowBandwidth = ph->getParam<bool>(isLeft ? "i_left_rect_low_bandwidth" : "i_right_rect_low_bandwidth");
     if(lowBandwidth) {
         conv->convertFromBitstream(dai::RawImgFrame::Type::GRAY8);
@@ -184,8 +185,9 @@ void Stereo::setupRectQueue(std::shared_ptr<dai::Device> device,
     bool addCallback = !ph->getParam<bool>("i_publish_synced_rect_pair");
 
     if(ipcEnabled()) {
-        pub = getROSNode()->create_publisher<sensor_msgs::msg::Image>("~/" + sensorName + "/image_rect", 10);
-        infoPub = getROSNode()->create_publisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+        pub = getPublisher<sensor_msgs::msg::Image>("~/" + sensorName + "/image_rect", 10);
+        infoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+        subscribed = sensor_helpers::trackSubscription(*getSubscriptionTracker(), pub, infoPub);
         if(addCallback) {
             q->addCallback(std::bind(sensor_helpers::splitPub,
                                      std::placeholders::_1,
@@ -194,23 +196,51 @@ void Stereo::setupRectQueue(std::shared_ptr<dai::Device> device,
                                      pub,
                                      infoPub,
                                      im,
+                                     subscribed,
                                      ph->getParam<bool>("i_enable_lazy_publisher")));
         }
     } else {
-        pubIT = image_transport::create_camera_publisher(getROSNode(), "~/" + sensorName + "/image_rect");
+        pubIT = getCameraPublisher("~/" + sensorName + "/image_rect");
+        subscribed = getSubscriptionTracker()->track(pubIT);
         if(addCallback) {
-            q->addCallback(std::bind(
-                sensor_helpers::cameraPub, std::placeholders::_1, std::placeholders::_2, *conv, pubIT, im, ph->getParam<bool>("i_enable_lazy_publisher")));
+            q->addCallback(std::bind(sensor_helpers::cameraPub,
+                                     std::placeholders::_1,
+                                     std::placeholders::_2,
+                                     *conv,
+                                     pubIT,
+                                     im,
+                                     subscribed,
+                                     ph->getParam<bool>("i_enable_lazy_publisher")));
         }
     }
 }
 
 void Stereo::setupLeftRectQueue(std::shared_ptr<dai::Device> device) {
-    setupRectQueue(device, leftSensInfo, leftRectQName, leftRectConv, leftRectIM, leftRectQ, leftRectPub, leftRectInfoPub, leftRectPubIT, true);
+    setupRectQueue(device,
+                   leftSensInfo,
+                   leftRectQName,
+                   leftRectConv,
+                   leftRectIM,
+                   leftRectQ,
+                   leftRectPub,
+                   leftRectInfoPub,
+                   leftRectPubIT,
+                   leftRectSubscribed,
+                   true);
 }
 
 void Stereo::setupRightRectQueue(std::shared_ptr<dai::Device> device) {
-    setupRectQueue(device, rightSensInfo, rightRectQName, rightRectConv, rightRectIM, rightRectQ, rightRectPub, rightRectInfoPub, rightRectPubIT, false);
+    setupRectQueue(device,
+                   rightSensInfo,
+                   rightRectQName,
+                   rightRectConv,
+                   rightRectIM,
+                   rightRectQ,
+                   rightRectPub,
+                   rightRectInfoPub,
+                   rightRectPubIT,
+                   rightRectSubscribed,
+                   false);
 }
 
 void Stereo::setupStereoQueue(std::shared_ptr<dai::Device> device) {
@@ -221,9 +251,12 @@ void Stereo::setupStereoQueue(std::shared_ptr<dai::Device> device) {
         tfPrefix = getTFPrefix(utils::getSocketName(rightSensInfo.socket).c_str());
     }
     stereoConv = std::make_unique<dai::ros::ImageConverter>(tfPrefix + "_camera_optical_frame", false, ph->getParam<bool>("i_get_base_device_timestamp"));
-    stereoConv->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"));
+    stereoConv->setUpdateRosBaseTimeOnToRosMsg(ph->getParam<bool>("i_update_ros_base_time_on_ros_msg"), device->getMxId());
+    int decodeScale = 1;
     if(ph->getParam<bool>("i_low_bandwidth")) {
         stereoConv->convertFromBitstream(dai::RawImgFrame::Type::RAW8);
+        decodeScale = ph->getParam<int>("i_low_bandwidth_decode_scale");
+        stereoConv->setDecodeScale(decodeScale);
     }
 
     if(ph->getParam<bool>("i_add_exposure_offset")) {
@@ -242,9 +275,9 @@ void Stereo::setupStereoQueue(std::shared_ptr<dai::Device> device) {
                                              *stereoConv,
                                              device,
                                              static_cast<dai::CameraBoardSocket>(ph->getParam<int>("i_board_socket_id")),
-                                             ph->getParam<int>("i_width"),
-                                             ph->getParam<int>("i_height"));
-    auto calibHandler = device->readCalibration();
+                                             (ph->getParam<int>("i_width") + decodeScale - 1) / decodeScale,
+                                             (ph->getParam<int>("i_height") + decodeScale - 1) / decodeScale);
+    auto calibHandler = sensor_helpers::getCalibHandler(device);
     if(!ph->getParam<bool>("i_output_disparity")) {
         if(ph->getParam<bool>("i_reverse_stereo_socket_order")) {
             stereoConv->convertDispToDepth(calibHandler.getBaselineDistance(leftSensInfo.socket, rightSensInfo.socket, false));
@@ -265,9 +298,31 @@ void Stereo::setupStereoQueue(std::shared_ptr<dai::Device> device) {
 
     stereoIM->setCameraInfo(info);
     stereoQ = device->getOutputQueue(stereoQName, ph->getParam<int>("i_max_q_size"), false);
-    if(ipcEnabled()) {
-        stereoPub = getROSNode()->create_publisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
-        stereoInfoPub = getROSNode()->create_publisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+    bool passthrough = ph->getParam<bool>("i_low_bandwidth") && ph->getParam<bool>("i_low_bandwidth_passthrough");
+    if(passthrough && !ph->getParam<bool>("i_output_disparity")) {
+        RCLCPP_WARN(getROSNode()->get_logger(), "Bitstream passthrough carries disparity, set i_output_disparity to use it. Publishing depth instead.");
+        passthrough = false;
+    }
+    if(passthrough) {
+        // Bitstream goes out as is on the compressed transport topic, raw images are only decoded on demand.
+        stereoPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+        stereoCompressedPub = getPublisher<sensor_msgs::msg::CompressedImage>("~/" + getName() + "/image_raw/compressed", 10);
+        stereoInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
+        stereoQ->addCallback(std::bind(sensor_helpers::compressedPub,
+                                       std::placeholders::_1,
+                                       std::placeholders::_2,
+                                       *stereoConv,
+                                       stereoPub,
+                                       stereoCompressedPub,
+                                       stereoInfoPub,
+                                       stereoIM,
+                                       getSubscriptionTracker()->track(stereoPub),
+                                       getSubscriptionTracker()->track(stereoCompressedPub),
+                                       getSubscriptionTracker()->track(stereoInfoPub),
+                                       ph->getParam<bool>("i_enable_lazy_publisher")));
+    } else if(ipcEnabled()) {
+        stereoPub = getPublisher<sensor_msgs::msg::Image>("~/" + getName() + "/image_raw", 10);
+        stereoInfoPub = getPublisher<sensor_msgs::msg::CameraInfo>("~/" + getName() + "/camera_info", 10);
         stereoQ->addCallback(std::bind(sensor_helpers::splitPub,
                                        std::placeholders::_1,
                                        std::placeholders::_2,
@@ -275,15 +330,17 @@ void Stereo::setupStereoQueue(std::shared_ptr<dai::Device> device) {
                                        stereoPub,
                                        stereoInfoPub,
                                        stereoIM,
+                                       sensor_helpers::trackSubscription(*getSubscriptionTracker(), stereoPub, stereoInfoPub),
                                        ph->getParam<bool>("i_enable_lazy_publisher")));
     } else {
-        stereoPubIT = image_transport::create_camera_publisher(getROSNode(), "~/" + getName() + "/image_raw");
+        stereoPubIT = getCameraPublisher("~/" + getName() + "/image_raw");
         stereoQ->addCallback(std::bind(sensor_helpers::cameraPub,
                                        std::placeholders::_1,
                                        std::placeholders::_2,
                                        *stereoConv,
                                        stereoPubIT,
                                        stereoIM,
+                                       getSubscriptionTracker()->track(stereoPubIT),
                                        ph->getParam<bool>("i_enable_lazy_publisher")));
     }
 }
@@ -295,34 +352,29 @@ void Stereo::syncTimerCB() {
         RCLCPP_WARN(getROSNode()->get_logger(), "Left and right rectified frames are not synchronized!");
     } else {
         bool lazyPub = ph->getParam<bool>("i_enable_lazy_publisher");
-        if(ipcEnabled() && rclcpp::ok()
-           && (!lazyPub || sensor_helpers::detectSubscription(leftRectPub, leftRectInfoPub)
-               || sensor_helpers::detectSubscription(rightRectPub, rightRectInfoPub))) {
-            auto leftInfo = leftRectIM->getCameraInfo();
-            auto leftRawMsg = leftRectConv->toRosMsgRawPtr(left);
-            leftInfo.header = leftRawMsg.header;
-            auto rightInfo = rightRectIM->getCameraInfo();
-            auto rightRawMsg = rightRectConv->toRosMsgRawPtr(right);
-            rightRawMsg.header.stamp = leftRawMsg.header.stamp;
-            rightInfo.header = rightRawMsg.header;
-            sensor_msgs::msg::CameraInfo::UniquePtr leftInfoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(leftInfo);
-            sensor_msgs::msg::Image::UniquePtr leftMsg = std::make_unique<sensor_msgs::msg::Image>(leftRawMsg);
-            sensor_msgs::msg::CameraInfo::UniquePtr rightInfoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(rightInfo);
-            sensor_msgs::msg::Image::UniquePtr rightMsg = std::make_unique<sensor_msgs::msg::Image>(rightRawMsg);
+        bool subscribed = leftRectSubscribed->load(std::memory_order_relaxed) || rightRectSubscribed->load(std::memory_order_relaxed);
+        if(ipcEnabled() && rclcpp::ok() && (!lazyPub || subscribed)) {
+            sensor_msgs::msg::CameraInfo::UniquePtr leftInfoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(leftRectIM->getCameraInfo());
+            sensor_msgs::msg::Image::UniquePtr leftMsg = leftRectConv->toRosMsgUniquePtr(left);
+            leftInfoMsg->header = leftMsg->header;
+            sensor_msgs::msg::CameraInfo::UniquePtr rightInfoMsg = std::make_unique<sensor_msgs::msg::CameraInfo>(rightRectIM->getCameraInfo());
+            sensor_msgs::msg::Image::UniquePtr rightMsg = rightRectConv->toRosMsgUniquePtr(right);
+            rightMsg->header.stamp = leftMsg->header.stamp;
+            rightInfoMsg->header = rightMsg->header;
             leftRectPub->publish(std::move(leftMsg));
             leftRectInfoPub->publish(std::move(leftInfoMsg));
             rightRectPub->publish(std::move(rightMsg));
             rightRectInfoPub->publish(std::move(rightInfoMsg));
-        } else if(!ipcEnabled() && rclcpp::ok() && (!lazyPub || leftRectPubIT.getNumSubscribers() > 0 || rightRectPubIT.getNumSubscribers() > 0)) {
-            auto leftInfo = leftRectIM->getCameraInfo();
-            auto leftRawMsg = leftRectConv->toRosMsgRawPtr(left);
-            leftInfo.header = leftRawMsg.header;
-            auto rightInfo = rightRectIM->getCameraInfo();
-            auto rightRawMsg = rightRectConv->toRosMsgRawPtr(right);
-            rightRawMsg.header.stamp = leftRawMsg.header.stamp;
-            rightInfo.header = rightRawMsg.header;
-            leftRectPubIT.publish(leftRawMsg, leftInfo);
-            rightRectPubIT.publish(rightRawMsg, rightInfo);
+        } else if(!ipcEnabled() && rclcpp::ok() && (!lazyPub || subscribed)) {
+            auto leftInfo = std::make_shared<sensor_msgs::msg::CameraInfo>(leftRectIM->getCameraInfo());
+            sensor_msgs::msg::Image::SharedPtr leftMsg = leftRectConv->toRosMsgUniquePtr(left);
+            leftInfo->header = leftMsg->header;
+            auto rightInfo = std::make_shared<sensor_msgs::msg::CameraInfo>(rightRectIM->getCameraInfo());
+            sensor_msgs::msg::Image::SharedPtr rightMsg = rightRectConv->toRosMsgUniquePtr(right);
+            rightMsg->header.stamp = leftMsg->header.stamp;
+            rightInfo->header = rightMsg->header;
+            leftRectPubIT.publish(leftMsg, leftInfo);
+            rightRectPubIT.publish(rightMsg, rightInfo);
         }
     }
 }
@@ -400,5 +452,15 @@ void Stereo::updateParams(const std::vector<rclcpp::Parameter>& params) {
     ph->setRuntimeParams(params);
 }
 
+void Stereo::activate() {
+    left->activate();
+    right->activate();
+}
+
+void Stereo::deactivate() {
+    left->deactivate();
+    right->deactivate();
+}
+
 }  // namespace dai_nodes
 }  // namespace depthai_ros_driver
@@ -10,7 +10,14 @@
 
 namespace depthai_ros_driver {
 namespace dai_nodes {
-SysLogger::SysLogger(const std::string& daiNodeName, rclcpp::Node* node, std::shared_ptr<dai::Pipeline> pipeline) : BaseNode(daiNodeName, node, pipeline) {
+// Same as the timeout the diagnostics callback used to wait on the queue for.
+static const std::chrono::seconds SYS_INFO_TIMEOUT{5};
+
+SysLogger::SysLogger(const std::string& daiNodeName,
+                     rclcpp::Node* node,
+                     std::shared_ptr<dai::Pipeline> pipeline,
+                     std::function<void(const std::string&)> errorCB)
+    : BaseNode(daiNodeName, node, pipeline), errorCB(errorCB) {
     RCLCPP_DEBUG(node->get_logger(), "Creating node %s", daiNodeName.c_str());
     setNames();
     sysNode = pipeline->create<dai::node::SystemLogger>();
@@ -30,52 +37,94 @@ void SysLogger::setXinXout(std::shared_ptr<dai::Pipeline> pipeline) {
 }
 
 void SysLogger::setupQueues(std::shared_ptr<dai::Device> device) {
+    sysInfoPub = getPublisher<depthai_ros_msgs::msg::SystemInformation>("~/" + getName() + "/system_information", 10);
     loggerQ = device->getOutputQueue(loggerQName, 8, false);
+    setupTime = std::chrono::steady_clock::now();
+    loggerQ->addCallback(std::bind(&SysLogger::sysInfoCB, this, std::placeholders::_1, std::placeholders::_2));
     updater = std::make_shared<diagnostic_updater::Updater>(getROSNode());
     updater->setHardwareID(getROSNode()->get_name() + std::string("_") + device->getMxId() + std::string("_") + device->getDeviceName());
     updater->add("sys_logger", std::bind(&SysLogger::produceDiagnostics, this, std::placeholders::_1));
 }
 
 void SysLogger::closeQueues() {
+    closed = true;
     loggerQ->close();
 }
 
-std::string SysLogger::sysInfoToString(const dai::SystemInformation& sysInfo) {
-    std::stringstream ss;
-    ss << "System Information: " << std::endl;
-    ss << "  Leon CSS CPU Usage: " << sysInfo.leonCssCpuUsage.average * 100 << std::endl;
-    ss << "  Leon MSS CPU Usage: " << sysInfo.leonMssCpuUsage.average * 100 << std::endl;
-    ss << " Ddr Memory Usage: " << sysInfo.ddrMemoryUsage.used / (1024.0f * 1024.0f) << std::endl;
-    ss << " Ddr Memory Total: " << sysInfo.ddrMemoryUsage.total / (1024.0f * 1024.0f) << std::endl;
-    ss << " Cmx Memory Usage: " << sysInfo.cmxMemoryUsage.used / (1024.0f * 1024.0f) << std::endl;
-    ss << " Cmx Memory Total: " << sysInfo.cmxMemoryUsage.total << std::endl;
-    ss << " Leon CSS Memory Usage: " << sysInfo.leonCssMemoryUsage.used / (1024.0f * 1024.0f) << std::endl;
-    ss << " Leon CSS Memory Total: " << sysInfo.leonCssMemoryUsage.total / (1024.0f * 1024.0f) << std::endl;
-    ss << " Leon MSS Memory Usage: " << sysInfo.leonMssMemoryUsage.used / (1024.0f * 1024.0f) << std::endl;
-    ss << " Leon MSS Memory Total: " << sysInfo.leonMssMemoryUsage.total / (1024.0f * 1024.0f) << std::endl;
-    ss << " Average Chip Temperature: " << sysInfo.chipTemperature.average << std::endl;
-    ss << " Leon CSS Chip Temperature: " << sysInfo.chipTemperature.css << std::endl;
-    ss << " Leon MSS Chip Temperature: " << sysInfo.chipTemperature.mss << std::endl;
-    ss << " UPA Chip Temperature: " << sysInfo.chipTemperature.upa << std::endl;
-    ss << " DSS Chip Temperature: " << sysInfo.chipTemperature.dss << std::endl;
-
-    return ss.str();
+void SysLogger::sysInfoCB(const std::string& /*name*/, const std::shared_ptr<dai::ADatatype>& data) {
+    auto sysInfo = std::dynamic_pointer_cast<dai::SystemInformation>(data);
+    if(!sysInfo) {
+        return;
+    }
+    lastReceivedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    const float mib = 1024.0f * 1024.0f;
+    auto msg = std::make_unique<depthai_ros_msgs::msg::SystemInformation>();
+    msg->header.stamp = getROSNode()->now();
+    msg->leon_css_cpu_usage = sysInfo->leonCssCpuUsage.average * 100.0f;
+    msg->leon_mss_cpu_usage = sysInfo->leonMssCpuUsage.average * 100.0f;
+    msg->ddr_memory_used = sysInfo->ddrMemoryUsage.used / mib;
+    msg->ddr_memory_total = sysInfo->ddrMemoryUsage.total / mib;
+    msg->cmx_memory_used = sysInfo->cmxMemoryUsage.used / mib;
+    msg->cmx_memory_total = sysInfo->cmxMemoryUsage.total / mib;
+    msg->leon_css_memory_used = sysInfo->leonCssMemoryUsage.used / mib;
+    msg->leon_css_memory_total = sysInfo->leonCssMemoryUsage.total / mib;
+    msg->leon_mss_memory_used = sysInfo->leonMssMemoryUsage.used / mib;
+    msg->leon_mss_memory_total = sysInfo->leonMssMemoryUsage.total / mib;
+    msg->chip_temperature_average = sysInfo->chipTemperature.average;
+    msg->chip_temperature_css = sysInfo->chipTemperature.css;
+    msg->chip_temperature_mss = sysInfo->chipTemperature.mss;
+    msg->chip_temperature_upa = sysInfo->chipTemperature.upa;
+    msg->chip_temperature_dss = sysInfo->chipTemperature.dss;
+    {
+        std::lock_guard<std::mutex> lock(lastSysInfoMtx);
+        lastSysInfo = std::make_shared<const depthai_ros_msgs::msg::SystemInformation>(*msg);
+    }
+    sysInfoPub->publish(std::move(msg));
 }
 
 void SysLogger::produceDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& stat) {
-    try {
-        bool timeout;
-        auto logData = loggerQ->get<dai::SystemInformation>(std::chrono::seconds(5), timeout);
-        if(!timeout) {
-            stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "System Information");
-            stat.add("System Information", sysInfoToString(*logData));
-        } else {
-            stat.summary(diagnostic_msgs::msg::DiagnosticStatus::ERROR, "No Data");
+    if(closed) {
+        stat.summary(diagnostic_msgs::msg::DiagnosticStatus::STALE, "Stopped");
+        return;
+    }
+    int64_t receivedNs = lastReceivedNs;
+    auto lastReceived = receivedNs > 0 ? std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                             std::chrono::nanoseconds(receivedNs)))
+                                       : setupTime;
+    if(std::chrono::steady_clock::now() - lastReceived > SYS_INFO_TIMEOUT) {
+        stat.summary(diagnostic_msgs::msg::DiagnosticStatus::ERROR, "No Data");
+        if(!stale && errorCB) {
+            errorCB("No system information received from the device.");
         }
-    } catch(const std::exception& e) {
-        RCLCPP_ERROR(getROSNode()->get_logger(), "No data on logger queue!");
-        stat.summary(diagnostic_msgs::msg::DiagnosticStatus::ERROR, e.what());
+        stale = true;
+        return;
+    }
+    stale = false;
+    std::shared_ptr<const depthai_ros_msgs::msg::SystemInformation> info;
+    {
+        std::lock_guard<std::mutex> lock(lastSysInfoMtx);
+        info = lastSysInfo;
+    }
+    if(!info) {
+        stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "Waiting for system information");
+        return;
     }
+    stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "System Information");
+    stat.add("Leon CSS CPU Usage [%]", info->leon_css_cpu_usage);
+    stat.add("Leon MSS CPU Usage [%]", info->leon_mss_cpu_usage);
+    stat.add("Ddr Memory Usage [MiB]", info->ddr_memory_used);
+    stat.add("Ddr Memory Total [MiB]", info->ddr_memory_total);
+    stat.add("Cmx Memory Usage [MiB]", info->cmx_memory_used);
+    stat.add("Cmx Memory Total [MiB]", info->cmx_memory_total);
+    stat.add("Leon CSS Memory Usage [MiB]", info->leon_css_memory_used);
+    stat.add("Leon CSS Memory Total [MiB]", info->leon_css_memory_total);
+    stat.add("Leon MSS Memory Usage [MiB]", info->leon_mss_memory_used);
+    stat.add("Leon MSS Memory Total [MiB]", info->leon_mss_memory_total);
+    stat.add("Average Chip Temperature [C]", info->chip_temperature_average);
+    stat.add("Leon CSS Chip Temperature [C]", info->chip_temperature_css);
+    stat.add("Leon MSS Chip Temperature [C]", info->chip_temperature_mss);
+    stat.add("UPA Chip Temperature [C]", info->chip_temperature_upa);
+    stat.add("DSS Chip Temperature [C]", info->chip_temperature_dss);
 }
 
 }  // namespace dai_nodes
@@ -0,0 +1,135 @@
+#include "depthai_ros_driver/device_manager.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+#include "rclcpp/logging.hpp"
+#include "rclcpp/utilities.hpp"
+
+namespace depthai_ros_driver {
+
+// Enumerations finishing within this window are shared by all cameras waiting for a device.
+static const std::chrono::milliseconds ENUMERATION_MAX_AGE{500};
+static const std::chrono::milliseconds INITIAL_RETRY_DELAY{100};
+static const std::chrono::milliseconds MAX_RETRY_DELAY{2000};
+static const std::chrono::milliseconds SHUTDOWN_CHECK_PERIOD{50};
+
+std::shared_ptr<DeviceManager> DeviceManager::getInstance() {
+    static std::mutex instanceMutex;
+    static std::weak_ptr<DeviceManager> instance;
+    std::lock_guard<std::mutex> lock(instanceMutex);
+    auto manager = instance.lock();
+    if(!manager) {
+        manager = std::make_shared<DeviceManager>();
+        instance = manager;
+    }
+    return manager;
+}
+
+std::future<std::shared_ptr<dai::Device>> DeviceManager::acquireDevice(const DeviceRequest& request, const rclcpp::Logger& logger) {
+    auto self = shared_from_this();
+    return std::async(std::launch::async, [self, request, logger]() {
+        auto waiting = [&request]() { return rclcpp::ok() && !(request.cancelled && *request.cancelled); };
+        auto delay = INITIAL_RETRY_DELAY;
+        while(waiting()) {
+            try {
+                auto device = self->bootDevice(request, logger);
+                if(device) {
+                    return device;
+                }
+            } catch(const std::runtime_error& e) {
+                RCLCPP_ERROR(logger, "%s", e.what());
+            }
+            RCLCPP_DEBUG(logger, "Retrying to connect in %ld ms", static_cast<long>(delay.count()));
+            auto retryTime = std::chrono::steady_clock::now() + delay;
+            while(waiting() && std::chrono::steady_clock::now() < retryTime) {
+                std::this_thread::sleep_for(SHUTDOWN_CHECK_PERIOD);
+            }
+            delay = std::min(delay * 2, MAX_RETRY_DELAY);
+        }
+        return std::shared_ptr<dai::Device>();
+    });
+}
+
+std::shared_ptr<dai::Device> DeviceManager::bootDevice(const DeviceRequest& request, const rclcpp::Logger& logger) {
+    auto devices = getAvailableDevices();
+    if(devices.empty()) {
+        throw std::runtime_error("No devices detected!");
+    }
+    dai::DeviceInfo info;
+    if(!claimDevice(request, devices, info, logger)) {
+        return nullptr;
+    }
+    std::string mxId = info.getMxId();
+    dai::Device* device = nullptr;
+    try {
+        if(!request.ip.empty()) {
+            device = new dai::Device(info);
+        } else {
+            device = new dai::Device(info, request.usbSpeed);
+        }
+    } catch(...) {
+        releaseDevice(mxId);
+        throw;
+    }
+    // The claim is dropped together with the device, so a restarting camera can take its device again.
+    auto self = shared_from_this();
+    return std::shared_ptr<dai::Device>(device, [self, mxId](dai::Device* ptr) {
+        delete ptr;
+        self->releaseDevice(mxId);
+    });
+}
+
+std::vector<dai::DeviceInfo> DeviceManager::getAvailableDevices() {
+    std::lock_guard<std::mutex> lock(enumerationMutex);
+    // Cameras that waited for an enumeration in progress reuse its result instead of enumerating again.
+    if(std::chrono::steady_clock::now() - lastEnumeration > ENUMERATION_MAX_AGE) {
+        availableDevices = dai::Device::getAllAvailableDevices();
+        lastEnumeration = std::chrono::steady_clock::now();
+    }
+    return availableDevices;
+}
+
+bool DeviceManager::claimDevice(const DeviceRequest& request,
+                                const std::vector<dai::DeviceInfo>& devices,
+                                dai::DeviceInfo& claimed,
+                                const rclcpp::Logger& logger) {
+    bool anyDevice = request.mxId.empty() && request.ip.empty() && request.usbPortId.empty();
+    if(anyDevice) {
+        RCLCPP_INFO(logger, "No ip/mxid specified, connecting to the next available device.");
+    }
+    std::lock_guard<std::mutex> lock(claimMutex);
+    for(const auto& info : devices) {
+        if(claimedDevices.count(info.getMxId())) {
+            continue;
+        }
+        if(!anyDevice) {
+            if(!request.mxId.empty() && info.getMxId() == request.mxId) {
+                RCLCPP_INFO(logger, "Connecting to the camera using mxid: %s", request.mxId.c_str());
+            } else if(!request.ip.empty() && info.name == request.ip) {
+                RCLCPP_INFO(logger, "Connecting to the camera using ip: %s", request.ip.c_str());
+            } else if(!request.usbPortId.empty() && info.name == request.usbPortId) {
+                RCLCPP_INFO(logger, "Connecting to the camera using USB ID: %s", request.usbPortId.c_str());
+            } else {
+                RCLCPP_INFO(logger, "Ignoring device info: MXID: %s, Name: %s", info.getMxId().c_str(), info.name.c_str());
+                continue;
+            }
+        }
+        if(info.state == X_LINK_UNBOOTED || info.state == X_LINK_BOOTLOADER) {
+            claimedDevices.insert(info.getMxId());
+            claimed = info;
+            return true;
+        } else if(info.state == X_LINK_BOOTED && !anyDevice) {
+            throw std::runtime_error("Device is already booted in different process.");
+        }
+    }
+    return false;
+}
+
+void DeviceManager::releaseDevice(const std::string& mxId) {
+    std::lock_guard<std::mutex> lock(claimMutex);
+    claimedDevices.erase(mxId);
+}
+
+}  // namespace depthai_ros_driver
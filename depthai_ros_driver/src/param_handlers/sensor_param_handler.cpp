@@ -20,9 +20,15 @@ void SensorParamHandler::declareCommonParams(dai::CameraBoardSocket socket) {
     declareAndLogParam<int>("i_max_q_size", 30);
     declareAndLogParam<bool>("i_low_bandwidth", false);
     declareAndLogParam<int>("i_low_bandwidth_quality", 50);
+    declareAndLogParam<std::string>("i_low_bandwidth_profile", "MJPEG");
+    declareAndLogParam<int>("i_low_bandwidth_bitrate", 0);
+    declareAndLogParam<int>("i_low_bandwidth_frame_freq", 30);
+    declareAndLogParam<int>("i_low_bandwidth_decode_scale", 1);
+    declareAndLogParam<bool>("i_low_bandwidth_passthrough", false);
     declareAndLogParam<std::string>("i_calibration_file", "");
     declareAndLogParam<bool>("i_simulate_from_topic", false);
     declareAndLogParam<std::string>("i_simulated_topic_name", "");
+    declareAndLogParam<bool>("i_simulate_planar", false);
     declareAndLogParam<bool>("i_disable_node", false);
     declareAndLogParam<bool>("i_get_base_device_timestamp", false);
     socketID = static_cast<dai::CameraBoardSocket>(declareAndLogParam<int>("i_board_socket_id", static_cast<int>(socket), 0));
@@ -77,6 +83,7 @@ void SensorParamHandler::declareParams(std::shared_ptr<dai::node::ColorCamera> c
     declareAndLogParam<bool>("i_publish_topic", publish);
     colorCam->setBoardSocket(socketID);
     declareAndLogParam<bool>("i_output_isp", true);
+    declareAndLogParam<bool>("i_publish_native_yuv", false);
     declareAndLogParam<bool>("i_enable_preview", false);
     colorCam->setFps(declareAndLogParam<double>("i_fps", 30.0));
     int preview_size = declareAndLogParam<int>("i_preview_size", 300);
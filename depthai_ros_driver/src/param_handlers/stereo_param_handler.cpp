@@ -56,6 +56,8 @@ void StereoParamHandler::declareParams(std::shared_ptr<dai::node::StereoDepth> s
     declareAndLogParam<int>("i_max_q_size", 30);
     declareAndLogParam<bool>("i_low_bandwidth", false);
     declareAndLogParam<int>("i_low_bandwidth_quality", 50);
+    declareAndLogParam<int>("i_low_bandwidth_decode_scale", 1);
+    declareAndLogParam<bool>("i_low_bandwidth_passthrough", false);
     declareAndLogParam<bool>("i_output_disparity", false);
     declareAndLogParam<bool>("i_get_base_device_timestamp", false);
     declareAndLogParam<bool>("i_update_ros_base_time_on_ros_msg", false);
@@ -0,0 +1,59 @@
+#include "depthai_ros_driver/publisher_cache.hpp"
+
+namespace depthai_ros_driver {
+
+PublisherCache::PublisherCache(rclcpp::Node* node) : rosNode(node) {}
+
+std::shared_ptr<PublisherCache> PublisherCache::getInstance(rclcpp::Node* node) {
+    static std::mutex instancesMutex;
+    static std::map<const rclcpp::Node*, std::weak_ptr<PublisherCache>> instances;
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    for(auto it = instances.begin(); it != instances.end();) {
+        if(it->second.expired()) {
+            it = instances.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    auto cache = instances[node].lock();
+    if(!cache) {
+        cache = std::make_shared<PublisherCache>(node);
+        instances[node] = cache;
+    }
+    return cache;
+}
+
+image_transport::CameraPublisher PublisherCache::getCameraPublisher(const std::string& topic) {
+    auto pub = getOrCreate<image_transport::CameraPublisher>(
+        topic, [&]() { return std::make_shared<image_transport::CameraPublisher>(image_transport::create_camera_publisher(rosNode, topic)); });
+    return *pub;
+}
+
+void PublisherCache::resetUsage() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    for(auto& entry : entries) {
+        entry.second.used = false;
+    }
+    reusedCount = 0;
+}
+
+size_t PublisherCache::releaseUnused() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    size_t released = 0;
+    for(auto it = entries.begin(); it != entries.end();) {
+        if(!it->second.used) {
+            it = entries.erase(it);
+            released++;
+        } else {
+            ++it;
+        }
+    }
+    return released;
+}
+
+size_t PublisherCache::getReusedCount() {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return reusedCount;
+}
+
+}  // namespace depthai_ros_driver